@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+#include <future>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+	const size_t operations = 200;
+
+	test::TabBar t;
+	MockDb db;
+	db._async_latency = std::chrono::microseconds(200);
+
+	auto p = db.prepare(insert_into(t).set(t.gamma = true, t.delta = parameter(t.delta)));
+	p.params.delta = 17;
+
+	const auto blocking_ns = benchmark::measure("200 inserts, 200us latency (one at a time)", iterations, [&](){
+			size_t affected_rows = 0;
+			for (size_t i = 0; i < operations; ++i)
+			{
+				affected_rows += db.async(p).get();
+			}
+			benchmark::consume(affected_rows);
+			});
+	const auto concurrent_ns = benchmark::measure("200 inserts, 200us latency (all in flight)", iterations, [&](){
+			std::vector<std::future<size_t>> inserts;
+			inserts.reserve(operations);
+			for (size_t i = 0; i < operations; ++i)
+			{
+				inserts.push_back(db.async(p));
+			}
+			size_t affected_rows = 0;
+			for (auto& insert : inserts)
+			{
+				affected_rows += insert.get();
+			}
+			benchmark::consume(affected_rows);
+			});
+	std::cout << "200 inserts: speedup " << blocking_ns / concurrent_ns << std::endl;
+
+	return 0;
+}
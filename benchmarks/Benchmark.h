@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_BENCHMARK_H
+#define SQLPP_BENCHMARK_H
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace benchmark
+{
+	// The number of iterations can be overridden by the first command line argument
+	inline std::size_t iterations(int argc, char** argv, std::size_t default_iterations)
+	{
+		return argc > 1 ? std::strtoul(argv[1], nullptr, 10) : default_iterations;
+	}
+
+	// Feed results into this sink to keep the optimizer from removing the measured code
+	inline void consume(std::size_t value)
+	{
+		static volatile std::size_t sink = 0;
+		sink = sink + value;
+	}
+
+	template<typename Function>
+		double measure(const std::string& name, std::size_t iterations, Function function)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				function();
+			}
+			const auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+			const auto ns = iterations ? duration.count() / static_cast<double>(iterations) : 0.0;
+			std::cout << name << ": " << ns << " ns/iteration" << std::endl;
+			return ns;
+		}
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 100);
+
+	test::TabBar t;
+
+	auto i = insert_into(t).columns(t.beta, t.gamma, t.delta);
+	for (int row = 0; row < 10000; ++row)
+	{
+		i.values.add(t.beta = "cheesecake no " + std::to_string(row), t.gamma = (row % 2 == 0), t.delta = row * 1000);
+	}
+
+	{
+		sqlpp::serializer_context_t context;
+		const auto size = serialized_size(i, context);
+		serialize(i, context);
+		if (size != context.size())
+		{
+			std::cerr << "insert 10000 rows: serialized_size() returned " << size << ", expected " << context.size() << std::endl;
+			return 1;
+		}
+	}
+
+	const auto growing_ns = benchmark::measure("insert 10000 rows (growing)", iterations, [&i](){
+			sqlpp::serializer_context_t context;
+			serialize(i, context);
+			benchmark::consume(context.size());
+			});
+	const auto reserved_ns = benchmark::measure("insert 10000 rows (serialized_size + reserve)", iterations, [&i](){
+			sqlpp::serializer_context_t context;
+			context.reserve(serialized_size(i, context));
+			serialize(i, context);
+			benchmark::consume(context.size());
+			});
+	std::cout << "insert 10000 rows: speedup " << growing_ns / reserved_ns << std::endl;
+
+	auto single = insert_into(t).set(t.beta = "cheesecake", t.gamma = true, t.delta = 17);
+	const auto single_growing_ns = benchmark::measure("insert 1 row (growing)", iterations * 1000, [&single](){
+			sqlpp::serializer_context_t context;
+			serialize(single, context);
+			benchmark::consume(context.size());
+			});
+	const auto single_reserved_ns = benchmark::measure("insert 1 row (serialized_size + reserve)", iterations * 1000, [&single](){
+			sqlpp::serializer_context_t context;
+			context.reserve(serialized_size(single, context));
+			serialize(single, context);
+			benchmark::consume(context.size());
+			});
+	std::cout << "insert 1 row: speedup " << single_growing_ns / single_reserved_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+
+	MockDb db;
+	test::TabBar t;
+
+	auto i = insert_into(t).columns(t.beta, t.gamma, t.delta);
+	for (int row = 0; row < 100000; ++row)
+	{
+		i.values.add(t.beta = "cheesecake no " + std::to_string(row), t.gamma = (row % 2 == 0), t.delta = row);
+	}
+
+	// Serialize into one string and write that
+	const auto contiguous_ns = benchmark::measure("insert 100000 rows (contiguous)", iterations, [&i, &db](){
+			MockDb::_serializer_context_t context;
+			serialize(i, context);
+			const sqlpp::chunk_t chunk{context.data(), context.size()};
+			benchmark::consume(db._write_chunks(&chunk, 1));
+			});
+
+	// Serialize into chunks and write them with one vectored write
+	const auto chunked_ns = benchmark::measure("insert 100000 rows (chunked)", iterations, [&i, &db](){
+			benchmark::consume(db.execute_chunked(i));
+			});
+	std::cout << "insert 100000 rows: speedup " << contiguous_ns / chunked_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+	const size_t rows = 1000000;
+
+	test::TabBar t;
+	MockDb db;
+	db._result_rows = rows;
+	auto s = select(t.alpha, t.gamma).from(t).where(true);
+
+	const auto row_ns = benchmark::measure("1000000 rows (row by row)", iterations, [&](){
+			int64_t sum = 0;
+			for (const auto& row : db(s))
+			{
+				sum += row.alpha + row.gamma;
+			}
+			benchmark::consume(static_cast<std::size_t>(sum));
+			});
+	const auto column_ns = benchmark::measure("1000000 rows (columns, 1024 rows per batch)", iterations, [&](){
+			int64_t sum = 0;
+			auto result = db(s);
+			auto batch = sqlpp::make_column_batch(result, 1024);
+			while (result.fetch_columns(batch))
+			{
+				const auto alpha = batch.column<0>().values();
+				const auto gamma = batch.column<1>().values();
+				for (size_t i = 0; i < batch.size(); ++i)
+				{
+					sum += alpha[i] + gamma[i];
+				}
+			}
+			benchmark::consume(static_cast<std::size_t>(sum));
+			});
+	std::cout << "1000000 rows: speedup " << row_ns / column_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::size_t allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	++allocations;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+namespace
+{
+	template<typename Function>
+		void count(const std::string& name, std::size_t parts, Function function)
+		{
+			const auto before = allocations;
+			function();
+			std::cout << name << ": " << static_cast<double>(allocations - before) / static_cast<double>(parts) << " allocations/dynamic part" << std::endl;
+		}
+}
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 100000);
+
+	MockDb db;
+	test::TabBar t;
+
+	// Each iteration adds four small conditions and serializes the statement
+	const auto small_where = [&db, &t](){
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where();
+		s.where.add(t.alpha > 7);
+		s.where.add(t.gamma == true);
+		s.where.add(t.alpha < 100 and t.alpha != 17);
+		s.where.add(t.beta == "cake");
+		sqlpp::serializer_context_t context;
+		serialize(s, context);
+		benchmark::consume(context.size());
+	};
+
+	// Large trees still go to the heap
+	const auto large_where = [&db, &t](){
+		auto s = dynamic_select(db, t.alpha).from(t).dynamic_where();
+		s.where.add(t.beta == "cheese" and t.beta != "cake" and t.beta.like("%eese") and t.beta > "apple pie");
+		sqlpp::serializer_context_t context;
+		serialize(s, context);
+		benchmark::consume(context.size());
+	};
+
+	// Dynamic columns are named_interpretable_t
+	const auto dynamic_columns = [&db, &t](){
+		auto s = dynamic_select(db).dynamic_columns().from(t);
+		s.selected_columns.add(t.alpha);
+		s.selected_columns.add(t.beta);
+		s.selected_columns.add((t.alpha + 1).as(sqlpp::alias::a));
+		sqlpp::serializer_context_t context;
+		serialize(s, context);
+		benchmark::consume(context.size());
+	};
+
+	// A report query with many dynamic columns and conditions, with and without an arena
+	const auto report = [&db, &t](const std::shared_ptr<sqlpp::arena_t>& arena){
+		auto s = dynamic_select(db).use_arena(arena).dynamic_columns().from(t).dynamic_where();
+		for (int i = 0; i < 20; ++i)
+		{
+			s.selected_columns.add(t.alpha);
+			s.where.add(t.alpha > i);
+		}
+		sqlpp::serializer_context_t context;
+		serialize(s, context);
+		benchmark::consume(context.size());
+	};
+	const auto report_without_arena = [&report](){ report(nullptr); };
+	const auto report_with_arena = [&report](){ report(sqlpp::make_arena()); };
+
+	count("small where conditions", 4, small_where);
+	count("large where condition", 1, large_where);
+	count("dynamic columns", 3, dynamic_columns);
+	count("report without arena", 40, report_without_arena);
+	count("report with arena", 40, report_with_arena);
+
+	benchmark::measure("small where conditions", iterations, small_where);
+	benchmark::measure("large where condition", iterations, large_where);
+	benchmark::measure("dynamic columns", iterations, dynamic_columns);
+	benchmark::measure("report without arena", iterations / 10, report_without_arena);
+	benchmark::measure("report with arena", iterations / 10, report_with_arena);
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+
+	MockDb db;
+	test::TabBar t;
+
+	// 30 dynamic columns
+	auto s = dynamic_select(db).dynamic_columns(t.alpha).from(t).where(true);
+	s.selected_columns.add(t.beta);
+	s.selected_columns.add(t.gamma);
+	s.selected_columns.add(t.delta);
+	s.selected_columns.add(t.beta.as(sqlpp::alias::a));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::b));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::c));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::d));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::e));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::f));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::g));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::h));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::i));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::j));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::k));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::l));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::m));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::n));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::o));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::p));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::q));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::s));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::t));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::u));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::v));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::w));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::x));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::y));
+	s.selected_columns.add(t.beta.as(sqlpp::alias::z));
+	db._result_rows = 100000;
+
+	const auto name_ns = benchmark::measure("100000 rows, 30 dynamic columns (at name)", iterations, [&](){
+			std::size_t size = 0;
+			for (const auto& row : db(s))
+			{
+				size += row.at("beta").view().size() + row.at("m").view().size() + row.at("z").view().size();
+			}
+			benchmark::consume(size);
+			});
+	const auto handle_ns = benchmark::measure("100000 rows, 30 dynamic columns (at handle)", iterations, [&](){
+			std::size_t size = 0;
+			auto result = db(s);
+			const auto beta = result.front().handle("beta");
+			const auto m = result.front().handle("m");
+			const auto z = result.front().handle("z");
+			for (const auto& row : result)
+			{
+				size += row.at(beta).view().size() + row.at(m).view().size() + row.at(z).view().size();
+			}
+			benchmark::consume(size);
+			});
+	std::cout << "100000 rows, 30 dynamic columns: speedup " << name_ns / handle_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+namespace
+{
+	// Renders every statement part on each call
+	struct uncached_context_t: public sqlpp::serializer_context_t
+	{
+	};
+
+	template<typename Context, typename Statement>
+		std::string serialize_once(const Statement& statement)
+		{
+			Context context;
+			serialize(statement, context);
+			return context.str();
+		}
+}
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 100000);
+
+	MockDb db;
+	test::TabBar t;
+
+	// 30 static columns, one column and the where condition are added at runtime
+	auto s = dynamic_select(db).dynamic_columns(
+			t.alpha, t.beta, t.gamma, t.delta,
+			t.alpha.as(sqlpp::alias::a), t.beta.as(sqlpp::alias::b), t.gamma.as(sqlpp::alias::c), t.delta.as(sqlpp::alias::d),
+			t.alpha.as(sqlpp::alias::e), t.beta.as(sqlpp::alias::f), t.gamma.as(sqlpp::alias::g), t.delta.as(sqlpp::alias::h),
+			t.alpha.as(sqlpp::alias::i), t.beta.as(sqlpp::alias::j), t.gamma.as(sqlpp::alias::k), t.delta.as(sqlpp::alias::l),
+			t.alpha.as(sqlpp::alias::m), t.beta.as(sqlpp::alias::n), t.gamma.as(sqlpp::alias::o), t.delta.as(sqlpp::alias::p),
+			t.alpha.as(sqlpp::alias::q), t.beta.as(sqlpp::alias::s), t.gamma.as(sqlpp::alias::t), t.delta.as(sqlpp::alias::u),
+			t.alpha.as(sqlpp::alias::v), t.beta.as(sqlpp::alias::w), t.gamma.as(sqlpp::alias::x), t.delta.as(sqlpp::alias::y),
+			t.alpha.as(sqlpp::alias::z), t.beta.as(sqlpp::alias::left))
+		.from(t)
+		.dynamic_where();
+	s.selected_columns.add(t.delta.as(sqlpp::alias::right));
+	s.where.add(t.alpha > 7);
+	s.where.add(t.beta == "cheesecake");
+
+	const auto expected = serialize_once<uncached_context_t>(s);
+	if (serialize_once<sqlpp::serializer_context_t>(s) != expected)
+	{
+		std::cerr << "dynamic select: serialized statements differ" << std::endl;
+		return 1;
+	}
+
+	const auto uncached_ns = benchmark::measure("dynamic select (uncached)", iterations, [&s](){
+			uncached_context_t context;
+			serialize(s, context);
+			benchmark::consume(context.size());
+			});
+	const auto cached_ns = benchmark::measure("dynamic select (cached static parts)", iterations, [&s](){
+			sqlpp::serializer_context_t context;
+			serialize(s, context);
+			benchmark::consume(context.size());
+			});
+	std::cout << "dynamic select: " << expected.size() << " chars, speedup " << uncached_ns / cached_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+namespace
+{
+	// Stands in for the work done per row by the caller
+	int64_t process(int64_t value)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			value = value * 6364136223846793005 + 1442695040888963407;
+		}
+		return value;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+	const size_t rows = 50000;
+	const size_t batch_size = 1000;
+
+	test::TabBar t;
+	MockDb db;
+	db._result_rows = rows;
+	db._fetch_latency = std::chrono::microseconds{1000};
+	auto s = select(t.alpha, t.gamma).from(t).where(true);
+
+	const auto column_ns = benchmark::measure("50000 rows (columns, 1ms per batch)", iterations, [&](){
+			int64_t sum = 0;
+			auto result = db(s);
+			auto batch = sqlpp::make_column_batch(result, batch_size);
+			while (result.fetch_columns(batch))
+			{
+				const auto alpha = batch.column<0>().values();
+				for (size_t i = 0; i < batch.size(); ++i)
+				{
+					sum += process(alpha[i]);
+				}
+			}
+			benchmark::consume(static_cast<std::size_t>(sum));
+			});
+	const auto prefetch_ns = benchmark::measure("50000 rows (prefetched, 1ms per batch)", iterations, [&](){
+			int64_t sum = 0;
+			auto result = sqlpp::prefetch(db(s), 2, batch_size);
+			while (const auto batch = result.next_batch())
+			{
+				const auto alpha = batch->column<0>().values();
+				for (size_t i = 0; i < batch->size(); ++i)
+				{
+					sum += process(alpha[i]);
+				}
+			}
+			benchmark::consume(static_cast<std::size_t>(sum));
+			});
+	std::cout << "50000 rows: speedup " << column_ns / prefetch_ns << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+#include <sstream>
+
+namespace
+{
+	// The std::ostream based context that connectors used to employ
+	struct ostream_context_t
+	{
+		std::ostringstream _os;
+
+		template<typename T>
+			std::ostream& operator<<(T t)
+			{
+				return _os << t;
+			}
+
+		static std::string escape(std::string arg)
+		{
+			return sqlpp::serializer_context_t::escape(arg);
+		}
+
+		std::string str() const
+		{
+			return _os.str();
+		}
+	};
+
+	template<typename Context, typename Statement>
+		std::string serialize_once(const Statement& statement)
+		{
+			Context context;
+			serialize(statement, context);
+			return context.str();
+		}
+
+	template<typename Statement>
+		bool compare(const std::string& name, const Statement& statement, std::size_t iterations)
+		{
+			const auto expected = serialize_once<ostream_context_t>(statement);
+			if (serialize_once<sqlpp::serializer_context_t>(statement) != expected)
+			{
+				std::cerr << name << ": serialized statements differ" << std::endl;
+				return false;
+			}
+
+			const auto ostream_ns = benchmark::measure(name + " (ostringstream)", iterations, [&statement](){
+					benchmark::consume(serialize_once<ostream_context_t>(statement).size());
+					});
+			const auto buffer_ns = benchmark::measure(name + " (buffer)", iterations, [&statement](){
+					sqlpp::serializer_context_t context;
+					serialize(statement, context);
+					benchmark::consume(context.size());
+					});
+			std::cout << name << ": " << expected.size() << " chars, speedup " << ostream_ns / buffer_ns << std::endl;
+			return true;
+		}
+}
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 100000);
+
+	test::TabBar t;
+
+	const auto s = select(all_of(t)).from(t).where(t.alpha > 7 and t.beta.like("%cake")).order_by(t.gamma.asc()).limit(10);
+
+	auto i = insert_into(t).columns(t.beta, t.gamma);
+	for (int row = 0; row < 1000; ++row)
+	{
+		i.values.add(t.beta = "cheesecake no " + std::to_string(row), t.gamma = (row % 2 == 0));
+	}
+
+	bool ok = true;
+	ok = compare("select", s, iterations) and ok;
+	ok = compare("insert 1000 rows", i, iterations / 1000 + 1) and ok;
+
+	return ok ? 0 : 1;
+}
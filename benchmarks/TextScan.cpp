@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+
+	test::TabBar t;
+	MockDb db;
+	db._result_rows = 1000000;
+	auto s = select(t.beta).from(t).where(true);
+	const std::string needle(argc > 2 ? argv[2] : "cheesecake with strawberries"); // not a compile time constant
+
+	const auto value_ns = benchmark::measure("1000000 text fields (value)", iterations, [&](){
+			std::size_t matches = 0;
+			for (const auto& row : db(s))
+			{
+				matches += row.beta.value() == needle;
+			}
+			benchmark::consume(matches);
+			});
+	const auto view_ns = benchmark::measure("1000000 text fields (view)", iterations, [&](){
+			std::size_t matches = 0;
+			for (const auto& row : db(s))
+			{
+				matches += row.beta.view() == sqlpp::string_view(needle);
+			}
+			benchmark::consume(matches);
+			});
+	std::cout << "1000000 text fields: speedup " << value_ns / view_ns << std::endl;
+
+	return 0;
+}
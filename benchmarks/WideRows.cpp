@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+namespace
+{
+	SQLPP_ALIAS_PROVIDER(c0)
+	SQLPP_ALIAS_PROVIDER(c1)
+	SQLPP_ALIAS_PROVIDER(c2)
+	SQLPP_ALIAS_PROVIDER(c3)
+	SQLPP_ALIAS_PROVIDER(c4)
+	SQLPP_ALIAS_PROVIDER(c5)
+	SQLPP_ALIAS_PROVIDER(c6)
+	SQLPP_ALIAS_PROVIDER(c7)
+	SQLPP_ALIAS_PROVIDER(c8)
+	SQLPP_ALIAS_PROVIDER(c9)
+	SQLPP_ALIAS_PROVIDER(c10)
+	SQLPP_ALIAS_PROVIDER(c11)
+	SQLPP_ALIAS_PROVIDER(c12)
+	SQLPP_ALIAS_PROVIDER(c13)
+	SQLPP_ALIAS_PROVIDER(c14)
+	SQLPP_ALIAS_PROVIDER(c15)
+	SQLPP_ALIAS_PROVIDER(c16)
+	SQLPP_ALIAS_PROVIDER(c17)
+	SQLPP_ALIAS_PROVIDER(c18)
+
+	// Reads all fields, called through a pointer to keep the compiler from folding the row state into the loop
+	template<typename Row>
+		int64_t read_all_fields(const Row& row)
+		{
+			return static_cast<int64_t>(row.alpha.value() + row.beta.view().size() + row.gamma.value() + row.delta.value() + row.a.value() +
+				row.b.view().size() + row.c.value() + row.d.value() + row.e.value() + row.f.view().size() + row.g.value() + row.h.value() +
+				row.i.value() + row.j.view().size() + row.k.value() + row.l.value() + row.m.value() + row.n.view().size() + row.o.value() +
+				row.p.value() + row.q.value() + row.s.view().size() + row.t.value() + row.u.value() + row.v.value() + row.w.view().size() +
+				row.x.value() + row.y.value() + row.z.value() + row.left.view().size() + row.right.value() + row.c0.value() +
+				row.c1.view().size() + row.c2.value() + row.c3.value() + row.c4.value() + row.c5.view().size() + row.c6.value() +
+				row.c7.value() + row.c8.value() + row.c9.view().size() + row.c10.value() + row.c11.value() + row.c12.value() +
+				row.c13.view().size() + row.c14.value() + row.c15.value() + row.c16.value() + row.c17.view().size() + row.c18.value());
+		}
+}
+
+int main(int argc, char** argv)
+{
+	const auto iterations = benchmark::iterations(argc, argv, 10);
+
+	MockDb db;
+	test::TabBar t;
+	db._result_rows = 100000;
+
+	// 50 columns
+	using namespace sqlpp::alias;
+	auto s = select(t.alpha, t.beta, t.gamma, t.delta,
+			t.alpha.as(a), t.beta.as(b), t.gamma.as(c), t.delta.as(d), t.alpha.as(e), t.beta.as(f), t.gamma.as(g), t.delta.as(h),
+			t.alpha.as(i), t.beta.as(j), t.gamma.as(k), t.delta.as(l), t.alpha.as(m), t.beta.as(n), t.gamma.as(o), t.delta.as(p),
+			t.alpha.as(q), t.beta.as(sqlpp::alias::s), t.gamma.as(sqlpp::alias::t), t.delta.as(u), t.alpha.as(v), t.beta.as(w),
+			t.gamma.as(x), t.delta.as(y), t.alpha.as(z), t.beta.as(left), t.gamma.as(right),
+			t.alpha.as(c0), t.beta.as(c1), t.gamma.as(c2), t.delta.as(c3), t.alpha.as(c4), t.beta.as(c5), t.gamma.as(c6),
+			t.delta.as(c7), t.alpha.as(c8), t.beta.as(c9), t.gamma.as(c10), t.delta.as(c11), t.alpha.as(c12), t.beta.as(c13),
+			t.gamma.as(c14), t.delta.as(c15), t.alpha.as(c16), t.beta.as(c17), t.gamma.as(c18))
+		.from(t).where(true);
+
+	using Row = typename std::decay<decltype(db(s).front())>::type;
+	int64_t (* volatile read_row)(const Row&) = &read_all_fields<Row>;
+
+	benchmark::measure("100000 rows, 50 columns read", iterations, [&](){
+			int64_t sum = 0;
+			for (const auto& row : db(s))
+			{
+				sum += read_row(row);
+			}
+			benchmark::consume(static_cast<std::size_t>(sum));
+			});
+
+	return 0;
+}
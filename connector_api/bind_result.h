@@ -79,12 +79,43 @@ namespace sqlpp
 			};
 			*/
 
+			//! optional: bulk retrieval of rows into a sqlpp::column_batch_t, used by result_t::fetch_columns() if present
+			//! otherwise the batch is filled by calling next() once per row
+			//! sqlpp::prefetch() calls it on a helper thread, see sqlpp11/prefetch.h
+			template<typename ColumnBatch>
+			void _fetch_columns(ColumnBatch& batch);
+
+			// something similar to this:
+			/*
+			{
+				batch._bind(*this); // bind the free part of the column arrays, at most batch._free() rows
+				const auto rows = fetch_rows_impl(batch._free());
+				batch._grow(rows);
+			};
+			*/
+
+			//! optional: called by the result row before its fields, fills the NULL indicators of count fields in bulk,
+			//! one bit per field index, see sqlpp11/null_bitmap.h. is_null of the field binds below is nullptr then
+			void _bind_null_bitmap(sqlpp::null_bitmap_ref_t is_null, size_t count);
+
 			// These are called by the result row to bind individual result values
 			// More will be added over time
+			// Without _bind_null_bitmap, is_null points to the indicator of the field in the row, it stays valid
+			// as long as the row, so connectors may keep the pointers and write them when fetching
 			void _bind_boolean_result(size_t index, signed char* value, bool* is_null);
 			void _bind_floating_point_result(size_t index, double* value, bool* is_null);
 			void _bind_integral_result(size_t index, int64_t* value, bool* is_null);
 			void _bind_text_result(size_t index, const char** text, size_t* len);
+			void _bind_blob_result(size_t index, const char** data, size_t* len); // optional, _bind_text_result is used otherwise
+
+			// These are called by column batches to bind arrays of count result values, required for _fetch_columns
+			// The value types are the same as for the single value binds above.
+			// The NULL indicators are packed, one bit per row, set them via is_null.set(row, flag) or is_null.fill(), see sqlpp11/null_bitmap.h
+			void _bind_boolean_result_array(size_t index, signed char* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_floating_point_result_array(size_t index, double* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_integral_result_array(size_t index, int64_t* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_text_result_array(size_t index, std::string* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_blob_result_array(size_t index, std::vector<std::uint8_t>* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
 			...
 		};
 
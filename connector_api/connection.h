@@ -30,6 +30,7 @@
 
 #include <string>
 #include <sqlpp11/connection.h>
+#include <sqlpp11/serializer_context.h>
 #include <sqlpp11/database/char_result.h> // You may use char result or bind result or both
 #include <sqlpp11/database/bind_result.h> // to represent results of select and prepared select
 
@@ -40,12 +41,19 @@ namespace sqlpp
 		// The context is not a requirement, but if the database requires 
 		// any deviations from the SQL standard, you should use your own 
 		// context in order to specialize the behaviour, see also interpreter.h
-		struct context_t
+		// Deriving from sqlpp::serializer_context_t provides a buffer based appender.
+		struct context_t: public sqlpp::serializer_context_t
 		{
-			template<typename T>
-				std::ostream& operator<<(T t);
-
+			// If you change the escaping, change both. serialize_escaped() prefers append_escaped(),
+			// which writes directly into the context and avoids temporary strings. If only escape()
+			// is overridden, the inherited append_escaped() is ignored and escape() is used.
 			std::string escape(std::string arg);
+			context_t& append_escaped(const char* s, size_t len);
+
+			// optional: statements without runtime data are rendered once per type in a default constructed
+			// context and then copied, see static_sql.h. Not inherited from sqlpp::serializer_context_t.
+			// Do not opt in if the output depends on the state of the context (e.g. numbered parameters).
+			using _cache_static_sql = sqlpp::cache_static_sql_for<context_t>;
 		};
 
 		class connection: public sqlpp::connection // this inheritance helps with ADL for dynamic_select, for instance
@@ -56,6 +64,8 @@ namespace sqlpp
 							>;
 
 			using _prepared_statement_t = << handle to a prepared statement of the database >>;
+			using _keeps_parameter_bindings = std::true_type; // optional: the prepared statement keeps bound values between executions,
+			                                                  // _bind_params() then only binds the parameters modified since the last run
 			using _serializer_context_t = << This context is used to serialize a statement >>
 			using _interpreter_context_t = << This context is used interpret a statement >>;
 			                               // serializer and interpreter are typically the same for string based connectors
@@ -112,6 +122,46 @@ namespace sqlpp
 			template<typename PreparedRemove>
 			size_t run_prepared_remove(const PreparedRemove& r); // call r._bind_params()
 
+			//! execute a prepared insert, update or remove for a range of parameter sets (decltype(p.params))
+			template<typename PreparedStatement, typename Range>
+			size_t run_batch(PreparedStatement& p, const Range& parameter_sets); // return sqlpp::run_batch(*this, p, parameter_sets)
+
+			//! optional: execute a batch in one round trip, used by sqlpp::run_batch if present
+			//! otherwise sqlpp::run_batch executes the prepared statement once per parameter set
+			template<typename PreparedStatement, typename ParameterArrays>
+			size_t run_prepared_batch(const PreparedStatement& p, const ParameterArrays& arrays); // call arrays._bind(p._prepared_statement), then execute arrays.size() rows
+
+			//! execute independent statements and prepared statements in order, results are returned as a tuple
+			template<typename... Statements>
+			sqlpp::pipeline_result_t<connection, Statements...> run_pipeline(const Statements&... s); // return sqlpp::run_pipeline(*this, s...)
+
+			//! optional: send all statements before reading the first reply, used by sqlpp::run_pipeline if present
+			//! otherwise sqlpp::run_pipeline executes the statements one after the other
+			template<typename... Statements>
+			sqlpp::pipeline_result_t<connection, Statements...> _run_pipeline(const Statements&... s);
+
+			//! optional: send a statement serialized into a sqlpp::chunked_context_t without
+			//! joining the chunks, e.g. with a single writev() on the socket of the connection
+			size_t _write_chunks(const sqlpp::chunk_t* chunks, size_t count);
+
+			//! optional: "direct" execution of huge statements, e.g. bulk inserts
+			template<typename Statement>
+			size_t execute_chunked(const Statement& s); // serialize into a sqlpp::chunked_context_t, then call _write_chunks
+
+			//! optional: cache for the handles of directly executed statements, see sqlpp11/prepared_statement_cache.h
+			//! if enabled, select(), insert(), update() and remove() obtain a handle via sqlpp::prepare_cached() and run it
+			sqlpp::prepared_statement_cache_t<_prepared_statement_t>& statement_cache();
+
+			//! optional: executor for asynchronous operations, see sqlpp11/async.h
+			//! runs the task (e.g. once the response of the database arrived) on a thread of the connection
+			//! without _post(), sqlpp::async() queues the operations of the connection for a thread of its own,
+			//! they run one at a time in submission order
+			void _post(std::function<void()> task);
+
+			//! run a statement or prepared statement asynchronously
+			template<typename T>
+			auto async(const T& t) -> decltype(sqlpp::async(*this, t)); // return sqlpp::async(*this, t)
+
 			//! call run on the argument
 			template<typename T>
 				auto operator() (const T& t) -> decltype(t._run(*this))
@@ -28,8 +28,10 @@
 #ifndef SQLPP_DATABASE_PREPARED_STATEMENT_H
 #define SQLPP_DATABASE_PREPARED_STATEMENT_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace sqlpp
 {
@@ -54,6 +56,24 @@ namespace sqlpp
 			void _bind_floating_point_parameter(size_t index, const double* value, bool is_null);
 			void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null);
 			void _bind_text_parameter(size_t index, const std::string* value, bool is_null);
+
+			// Optional: blobs are bound as text otherwise
+			void _bind_blob_parameter(size_t index, const std::uint8_t* value, size_t len, bool is_null);
+
+			// Optional: text parameters that refer to memory owned by the caller (see parameter_value_t<text>::set_view)
+			// are bound with pointer and length. The characters stay valid until the statement has been executed.
+			// Without this method, they are copied into a std::string first.
+			void _bind_text_parameter(size_t index, const char* value, size_t len, bool is_null);
+
+			// Optional: called by sqlpp::parameter_arrays_t to bind the values of a batch of parameter sets,
+			// count values per parameter, see sqlpp11/batch.h.
+			// The value types are the same as for the single value binds above. The NULL indicators are packed,
+			// one bit per parameter set, read them via is_null.test(i), see sqlpp11/null_bitmap.h
+			void _bind_boolean_parameter_array(size_t index, const signed char* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_floating_point_parameter_array(size_t index, const double* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_integral_parameter_array(size_t index, const int64_t* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_text_parameter_array(size_t index, const std::string* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
+			void _bind_blob_parameter_array(size_t index, const std::vector<std::uint8_t>* values, sqlpp::null_bitmap_ref_t is_null, size_t count);
 		};
 	}
 }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_ARENA_H
+#define SQLPP_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace sqlpp
+{
+	// Monotonic memory for the dynamic parts of a statement.
+	// Memory is handed out from blocks and only released when the arena is destroyed.
+	class arena_t
+	{
+	public:
+		explicit arena_t(std::size_t block_size = 4096):
+			_block_size(block_size)
+		{}
+
+		arena_t(const arena_t&) = delete;
+		arena_t(arena_t&&) = delete;
+		arena_t& operator=(const arena_t&) = delete;
+		arena_t& operator=(arena_t&&) = delete;
+		~arena_t() = default;
+
+		void* allocate(std::size_t size, std::size_t alignment)
+		{
+			// Large requests get a block of their own, the current block stays in use
+			if (size + alignment > _block_size)
+			{
+				_large_blocks.emplace_back(new char[size + alignment]);
+				return _align(_large_blocks.back().get(), alignment);
+			}
+			if (not _pos or _available(alignment) < size)
+			{
+				_blocks.emplace_back(new char[_block_size]);
+				_pos = _blocks.back().get();
+				_end = _pos + _block_size;
+			}
+			const auto pos = _align(_pos, alignment);
+			_pos = pos + size;
+			return pos;
+		}
+
+		std::size_t block_count() const
+		{
+			return _blocks.size() + _large_blocks.size();
+		}
+
+	private:
+		std::size_t _available(std::size_t alignment) const
+		{
+			const auto padding = static_cast<std::size_t>(_align(_pos, alignment) - _pos);
+			const auto space = static_cast<std::size_t>(_end - _pos);
+			return space > padding ? space - padding : 0;
+		}
+
+		static char* _align(char* p, std::size_t alignment)
+		{
+			const auto address = reinterpret_cast<std::uintptr_t>(p);
+			return p + (alignment - address % alignment) % alignment;
+		}
+
+		std::size_t _block_size;
+		std::vector<std::unique_ptr<char[]>> _blocks;
+		std::vector<std::unique_ptr<char[]>> _large_blocks;
+		char* _pos = nullptr;
+		char* _end = nullptr;
+	};
+
+	inline std::shared_ptr<arena_t> make_arena(std::size_t block_size = 4096)
+	{
+		return std::make_shared<arena_t>(block_size);
+	}
+
+	// Allocates from the arena if there is one, from the free store otherwise.
+	// Containers share the arena, it is released with the last of them.
+	template<typename T>
+		struct arena_allocator
+		{
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::false_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			arena_allocator() = default;
+
+			arena_allocator(std::shared_ptr<arena_t> arena):
+				_arena(std::move(arena))
+			{}
+
+			template<typename U>
+				arena_allocator(const arena_allocator<U>& rhs):
+					_arena(rhs._arena)
+			{}
+
+			// Copies of a container allocate from the free store, see statement_arena_t
+			arena_allocator select_on_container_copy_construction() const
+			{
+				return {};
+			}
+
+			T* allocate(std::size_t n)
+			{
+				if (_arena)
+				{
+					return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+				}
+				return static_cast<T*>(::operator new(n * sizeof(T)));
+			}
+
+			void deallocate(T* p, std::size_t)
+			{
+				if (not _arena)
+				{
+					::operator delete(p);
+				}
+			}
+
+			std::shared_ptr<arena_t> _arena;
+		};
+
+	template<typename T, typename U>
+		bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs)
+		{
+			return lhs._arena == rhs._arena;
+		}
+
+	template<typename T, typename U>
+		bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs)
+		{
+			return lhs._arena != rhs._arena;
+		}
+
+	// The arena of a statement. arena_t is not thread-safe, but copies of a statement may be
+	// used concurrently (e.g. by sqlpp::async()), so copies do not share it: a copy constructed
+	// statement has no arena, a copy assigned one keeps its own.
+	class statement_arena_t
+	{
+	public:
+		statement_arena_t() = default;
+
+		explicit statement_arena_t(std::shared_ptr<arena_t> arena):
+			_arena(std::move(arena))
+		{}
+
+		statement_arena_t(const statement_arena_t&)
+		{}
+
+		statement_arena_t(statement_arena_t&&) = default;
+
+		statement_arena_t& operator=(const statement_arena_t&)
+		{
+			return *this;
+		}
+
+		statement_arena_t& operator=(statement_arena_t&&) = default;
+		~statement_arena_t() = default;
+
+		const std::shared_ptr<arena_t>& get() const
+		{
+			return _arena;
+		}
+
+		explicit operator bool() const
+		{
+			return static_cast<bool>(_arena);
+		}
+
+	private:
+		std::shared_ptr<arena_t> _arena;
+	};
+
+	namespace detail
+	{
+		// Statement data with dynamic parts provides _use_arena()
+		template<typename Data>
+			auto use_arena_impl(Data& data, const std::shared_ptr<arena_t>& arena, int)
+			-> decltype(data._use_arena(arena))
+			{
+				data._use_arena(arena);
+			}
+
+		template<typename Data>
+			void use_arena_impl(Data&, const std::shared_ptr<arena_t>&, long)
+			{}
+
+		template<typename Data>
+			void use_arena(Data& data, const std::shared_ptr<arena_t>& arena)
+			{
+				use_arena_impl(data, arena, 0);
+			}
+
+		// Moves the elements into a container that allocates from the arena
+		template<typename Container>
+			void move_to_arena(Container& container, const std::shared_ptr<arena_t>& arena)
+			{
+				if (container.get_allocator()._arena == arena)
+				{
+					return;
+				}
+				const auto allocator = typename Container::allocator_type(arena);
+				Container moved(allocator);
+				moved.reserve(container.size());
+				for (auto& element : container)
+				{
+					moved.push_back(std::move(element));
+				}
+				container.swap(moved);
+			}
+	}
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_ASYNC_H
+#define SQLPP_ASYNC_H
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <sqlpp11/type_traits.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// Direct statements are copied into the operation. Prepared statements are referenced:
+		// they have to outlive the operation and their parameters must not change until it completes.
+		template<typename T, typename Enable = void>
+			struct async_operand
+			{
+				using type = T;
+			};
+
+		template<typename T>
+			struct async_operand<T, typename std::enable_if<is_prepared_statement_t<T>::value>::type>
+			{
+				using type = std::reference_wrapper<const T>;
+			};
+
+		template<typename T>
+			using async_operand_t = typename async_operand<T>::type;
+
+		// Connectors with an executor of their own complete operations there
+		template<typename Db, typename Result>
+			auto post_async_impl(Db& db, std::function<Result()> operation, int)
+			-> decltype(db._post(std::function<void()>{}), std::future<Result>())
+			{
+				auto task = std::make_shared<std::packaged_task<Result()>>(std::move(operation));
+				auto future = task->get_future();
+				db._post([task](){ (*task)(); });
+				return future;
+			}
+
+		// Connections are not thread safe. Without an executor of the connection, operations are queued
+		// per connection and run in submission order by a thread that ends when the queue is empty.
+		// Operations on different connections do not wait for each other.
+		class async_queues_t
+		{
+			std::mutex _mutex;
+			std::unordered_map<const void*, std::deque<std::function<void()>>> _queues;
+
+			void _run(const void* db)
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				auto& queue = _queues[db];
+				while (true)
+				{
+					// the operation stays in the queue while it runs, later ones wait for it
+					auto operation = std::move(queue.front());
+					lock.unlock();
+					operation();
+					lock.lock();
+					queue.pop_front();
+					if (queue.empty())
+					{
+						_queues.erase(db);
+						return;
+					}
+				}
+			}
+
+		public:
+			void post(const void* db, std::function<void()> operation)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				auto& queue = _queues[db];
+				queue.push_back(std::move(operation));
+				if (queue.size() == 1)
+				{
+					std::thread(&async_queues_t::_run, this, db).detach();
+				}
+			}
+		};
+
+		// Never destroyed, queue threads might still finish after the end of main()
+		inline async_queues_t& async_queues()
+		{
+			static auto queues = new async_queues_t;
+			return *queues;
+		}
+
+		template<typename Db, typename Result>
+			std::future<Result> post_async_impl(Db& db, std::function<Result()> operation, long)
+			{
+				auto task = std::make_shared<std::packaged_task<Result()>>(std::move(operation));
+				auto future = task->get_future();
+				async_queues().post(&db, [task](){ (*task)(); });
+				return future;
+			}
+
+		template<typename Db, typename Result>
+			std::future<Result> post_async(Db& db, std::function<Result()> operation)
+			{
+				return post_async_impl(db, std::move(operation), 0);
+			}
+	}
+
+	// Runs a statement or prepared statement without blocking the calling thread.
+	// Connectors that provide _post() run the operation on their executor, see
+	// connector_api/connection.h, all others get a thread per connection that runs them in order.
+	// The connection must not be used otherwise until the future is ready.
+	template<typename Db, typename T>
+		auto async(Db& db, const T& t) -> std::future<decltype(db(t))>
+		{
+			using _result_t = decltype(db(t));
+			const auto operand = detail::async_operand_t<T>(t);
+			return detail::post_async<Db, _result_t>(db, [&db, operand]() -> _result_t
+					{
+						const T& statement = operand;
+						return db(statement);
+					});
+		}
+
+	// Fetches the next row of a result on the executor of the connection.
+	// The future yields false at the end of the result. The result must
+	// not be touched until the future is ready.
+	template<typename Db, typename Result>
+		std::future<bool> async_next(Db& db, Result& result)
+		{
+			return detail::post_async<Db, bool>(db, [&result]()
+					{
+						result.pop_front();
+						return not result.empty();
+					});
+		}
+}
+
+#endif
@@ -39,6 +39,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<floating_point, tag::is_expression, tag::is_selectable>;
 		using _nodes = detail::type_vector<Expr, aggregate_function>;
+		using _can_be_null = std::true_type; // NULL for an empty set of rows
 
 		static_assert(is_noop<Flag>::value or std::is_same<distinct_t, Flag>::value, "avg() used with flag other than 'distinct'");
 		static_assert(is_numeric_t<Expr>::value, "avg() requires a value expression as argument");
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_BATCH_H
+#define SQLPP_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <sqlpp11/null_bitmap.h>
+#include <sqlpp11/parameter_list.h>
+#include <sqlpp11/detail/index_sequence.h>
+
+namespace sqlpp
+{
+	// The values of one parameter in a batch of parameter sets
+	template<typename ParameterValue>
+		struct parameter_array_t
+		{
+			// Same element type as single value binds, e.g. signed char for booleans
+			using _value_type = typename ParameterValue::_bind_value_type;
+
+			explicit parameter_array_t(std::size_t capacity):
+				_values(new _value_type[capacity]()),
+				_null_bitmap(new std::uint8_t[null_bitmap_ref_t::bytes(capacity)]())
+			{}
+
+			void push_back(const ParameterValue& parameter)
+			{
+				null_bitmap_ref_t(_null_bitmap.get()).set(_size, parameter.is_null());
+				if (not parameter.is_null())
+				{
+					_values[_size] = parameter.value();
+				}
+				++_size;
+			}
+
+			template<typename Target>
+				void _bind(Target& target, std::size_t index) const
+				{
+					ParameterValue::_bind_array(target, index, _values.get(), null_bitmap_ref_t(_null_bitmap.get()), _size);
+				}
+
+			// Plain arrays, the NULL indicators are packed like those of column batches, see null_bitmap.h
+			std::unique_ptr<_value_type[]> _values;
+			std::unique_ptr<std::uint8_t[]> _null_bitmap;
+			std::size_t _size = 0;
+		};
+
+	template<typename ParameterList>
+		struct parameter_arrays_t
+		{
+			static_assert(wrong_t<parameter_arrays_t>::value, "Template parameter for parameter_arrays_t has to be a parameter_list_t");
+		};
+
+	// Column arrays (values plus null indicators) of a batch of parameter sets.
+	// Connectors with array binding bind them in one go, see connector_api/prepared_statement.h
+	template<typename... Parameter>
+		struct parameter_arrays_t<parameter_list_t<detail::type_vector<Parameter...>>>
+		{
+			using _parameter_list_t = parameter_list_t<detail::type_vector<Parameter...>>;
+			using _member_tuple_t = typename _parameter_list_t::_member_tuple_t;
+			using _array_tuple_t = std::tuple<parameter_array_t<typename std::decay<decltype(std::declval<const typename Parameter::_instance_t&>()())>::type>...>;
+
+			template<typename Range>
+				explicit parameter_arrays_t(const Range& parameter_sets):
+					_size(static_cast<std::size_t>(std::distance(std::begin(parameter_sets), std::end(parameter_sets)))),
+					_arrays(((void)sizeof(Parameter), _size)...)
+			{
+				for (const _parameter_list_t& parameter_set : parameter_sets)
+				{
+					_push_back(parameter_set, detail::make_index_sequence<sizeof...(Parameter)>{});
+				}
+			}
+
+			std::size_t size() const
+			{
+				return _size;
+			}
+
+			template<typename Target>
+				void _bind(Target& target) const
+				{
+					_bind_impl(target, detail::make_index_sequence<sizeof...(Parameter)>{});
+				}
+
+		private:
+			template<size_t... Is>
+				void _push_back(const _parameter_list_t& parameter_set, const detail::index_sequence<Is...>&)
+				{
+					using swallow = int[];  // see interpret_tuple.h
+					(void) swallow{0, (std::get<Is>(_arrays).push_back(static_cast<const typename std::tuple_element<Is, _member_tuple_t>::type&>(parameter_set)()), 0)...};
+				}
+
+			template<typename Target, size_t... Is>
+				void _bind_impl(Target& target, const detail::index_sequence<Is...>&) const
+				{
+					using swallow = int[];  // see interpret_tuple.h
+					(void) swallow{0, (std::get<Is>(_arrays)._bind(target, Is), 0)...};
+				}
+
+			std::size_t _size;
+			_array_tuple_t _arrays;
+		};
+
+	// Executes the prepared statement once per parameter set, one set at a time.
+	// The parameters of the prepared statement hold the last set afterwards.
+	template<typename Db, typename PreparedStatement, typename Range>
+		size_t run_batch_row_by_row(Db& db, PreparedStatement& prepared, const Range& parameter_sets)
+		{
+			size_t affected_rows = 0;
+			for (const auto& parameter_set : parameter_sets)
+			{
+				prepared.params = parameter_set;
+				affected_rows += db(prepared);
+			}
+			return affected_rows;
+		}
+
+	namespace detail
+	{
+		// Connectors with array binding execute the whole batch in one round trip
+		template<typename Db, typename PreparedStatement, typename Range>
+			auto run_batch_impl(Db& db, PreparedStatement& prepared, const Range& parameter_sets, int)
+			-> decltype(db.run_prepared_batch(prepared, std::declval<const parameter_arrays_t<typename PreparedStatement::_parameter_list_t>&>()))
+			{
+				const auto arrays = parameter_arrays_t<typename PreparedStatement::_parameter_list_t>{parameter_sets};
+				return db.run_prepared_batch(prepared, arrays);
+			}
+
+		template<typename Db, typename PreparedStatement, typename Range>
+			size_t run_batch_impl(Db& db, PreparedStatement& prepared, const Range& parameter_sets, long)
+			{
+				return run_batch_row_by_row(db, prepared, parameter_sets);
+			}
+	}
+
+	// Executes a prepared insert, update or remove for each parameter set in the range.
+	// Connectors that support array binding (run_prepared_batch) do that in one round trip,
+	// all others execute the statement row by row.
+	template<typename Db, typename PreparedStatement, typename Range>
+		size_t run_batch(Db& db, PreparedStatement& prepared, const Range& parameter_sets)
+		{
+			return detail::run_batch_impl(db, prepared, parameter_sets, 0);
+		}
+}
+
+#endif
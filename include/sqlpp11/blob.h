@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_BLOB_H
+#define SQLPP_BLOB_H
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <sqlpp11/basic_expression_operators.h>
+#include <sqlpp11/concepts.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/result_field.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/span.h>
+
+namespace sqlpp
+{
+	// blob value type
+	struct blob
+	{
+		using _traits = make_traits<blob, tag::is_value_type>;
+		using _tag = tag::is_blob;
+		using _cpp_value_type = std::vector<std::uint8_t>;
+
+		template<typename T>
+			using _is_valid_operand = is_blob_t<T>;
+	};
+
+	namespace detail
+	{
+		// Connectors bind blobs from pointer and length
+		template<typename Target>
+			auto bind_blob_parameter(Target& target, size_t index, span<const std::uint8_t> data, bool is_null, std::string&, int)
+			-> decltype(target._bind_blob_parameter(index, data.data(), data.size(), is_null))
+			{
+				return target._bind_blob_parameter(index, data.data(), data.size(), is_null);
+			}
+
+		// Connectors that do not know blobs yet bind them as text
+		template<typename Target>
+			void bind_blob_parameter(Target& target, size_t index, span<const std::uint8_t> data, bool is_null, std::string& copy, long)
+			{
+				copy.assign(reinterpret_cast<const char*>(data.data()), data.size());
+				target._bind_text_parameter(index, &copy, is_null);
+			}
+
+		template<typename Target>
+			auto bind_blob_result(Target& target, size_t index, const char** data, size_t* len, int)
+			-> decltype(target._bind_blob_result(index, data, len))
+			{
+				return target._bind_blob_result(index, data, len);
+			}
+
+		template<typename Target>
+			void bind_blob_result(Target& target, size_t index, const char** data, size_t* len, long)
+			{
+				target._bind_text_result(index, data, len);
+			}
+	}
+
+	// blob parameter type
+	template<>
+		struct parameter_value_t<blob>
+		{
+			using _value_type = blob;
+			using _cpp_value_type = typename _value_type::_cpp_value_type;
+
+			parameter_value_t():
+				_is_null(true)
+			{}
+
+			parameter_value_t(const _cpp_value_type& val):
+				_value(val),
+				_is_null(false)
+			{}
+
+			parameter_value_t& operator=(const _cpp_value_type& val)
+			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
+				_value = val;
+				_is_null = false;
+				return *this;
+			}
+
+			parameter_value_t& operator=(const tvin_t<wrap_operand_t<_cpp_value_type>>& t)
+			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
+				if (t._is_trivial())
+				{
+					_value.clear();
+					_is_null = true;
+				}
+				else
+				{
+					_value = t._value._t;
+					_is_null = false;
+				}
+				return *this;
+			}
+
+			parameter_value_t& operator=(const std::nullptr_t&)
+			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
+				_value.clear();
+				_is_null = true;
+				return *this;
+			}
+
+			// Refers to the bytes instead of copying them, see parameter_value_t<text>::set_view()
+			parameter_value_t& set_view(span<const std::uint8_t> view)
+			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_view = view;
+				_is_view = true;
+				_is_null = false;
+				return *this;
+			}
+
+			bool is_null() const
+			{ 
+				return _is_null; 
+			}
+
+			_cpp_value_type value() const
+			{
+				return _is_view ? _cpp_value_type(_view.begin(), _view.end()) : _value;
+			}
+
+			operator _cpp_value_type() const { return value(); }
+
+			template<typename Target>
+				void _bind(Target& target, size_t index) const
+				{
+					_is_dirty = false;
+					if (_bound_value)
+						detail::bind_blob_parameter(target, index, span<const std::uint8_t>(_bound_value->data(), _bound_value->size()), false, _copy, 0);
+					else if (_is_view)
+						detail::bind_blob_parameter(target, index, _view, false, _copy, 0);
+					else
+						detail::bind_blob_parameter(target, index, span<const std::uint8_t>(_value.data(), _value.size()), _is_null, _copy, 0);
+				}
+
+			template<typename Target>
+				static void _bind_array(Target& target, size_t index, const _cpp_value_type* values, null_bitmap_ref_t is_null, size_t count)
+				{
+					target._bind_blob_parameter_array(index, values, is_null, count);
+				}
+
+			// Modified since the last _bind(), see parameter_list_t::_bind(). Values owned by the caller might change any time.
+			bool _is_modified() const
+			{
+				return _is_dirty or _bound_value or _is_view;
+			}
+
+			// Bind a value owned by the caller instead, see parameter_binding.h
+			using _bind_value_type = _cpp_value_type;
+
+			void _bind_to(const _bind_value_type* value)
+			{
+				_is_dirty = true;
+				_bound_value = value;
+			}
+
+		private:
+			_cpp_value_type _value;
+			bool _is_null;
+			const _bind_value_type* _bound_value = nullptr;
+			mutable detail::dirty_flag_t _is_dirty;
+			span<const std::uint8_t> _view;
+			bool _is_view = false;
+			mutable std::string _copy;
+		};
+
+	// blob expression operators
+	template<typename Base>
+		struct expression_operators<Base, blob>: public basic_expression_operators<Base, blob>
+	{
+		template<typename T>
+			using _is_valid_operand = is_valid_operand<blob, T>;
+	};
+
+	// blob column operators
+	template<typename Base>
+		struct column_operators<Base, blob>
+		{
+			template<typename T>
+				using _is_valid_operand = is_valid_operand<blob, T>;
+		};
+
+	// blob result field
+	template<typename Db, typename FieldSpec>
+		struct result_field_t<blob, Db, FieldSpec>: public result_field_methods_t<result_field_t<blob, Db, FieldSpec>>
+	{
+		static_assert(std::is_same<value_type_of<FieldSpec>, blob>::value, "field type mismatch");
+		using _cpp_value_type = typename blob::_cpp_value_type;
+		using _bind_value_type = _cpp_value_type;
+
+		result_field_t():
+			_value_ptr(nullptr),
+			_len(0)
+		{}
+
+		bool operator==(const _cpp_value_type& rhs) const { return _len == rhs.size() and std::equal(rhs.begin(), rhs.end(), view().begin()); }
+		bool operator!=(const _cpp_value_type& rhs) const { return not operator==(rhs); }
+
+		bool is_null() const
+		{ 
+			return _value_ptr == nullptr; 
+		}
+
+		bool _is_trivial() const
+		{
+			return _len == 0;
+		}
+
+		// The bytes as provided by the connector, valid until the next row is fetched
+		span<const std::uint8_t> view() const
+		{
+			if (not _value_ptr)
+			{
+				if (enforce_null_result_treatment_t<Db>::value and not null_is_trivial_value_t<FieldSpec>::value)
+				{
+					throw exception("accessing value of NULL field");
+				}
+				return {};
+			}
+			return {reinterpret_cast<const std::uint8_t*>(_value_ptr), _len};
+		}
+
+		// A copy of the bytes
+		_cpp_value_type value() const
+		{
+			const auto bytes = view();
+			return _cpp_value_type(bytes.begin(), bytes.end());
+		}
+
+		template<typename Target>
+			void _bind(Target& target, size_t i)
+			{
+				detail::bind_blob_result(target, i, &_value_ptr, &_len, 0);
+			}
+
+		// Column arrays for fetching batches of rows, see column_batch.h
+		template<typename Target>
+			static void _bind_array(Target& target, size_t index, _bind_value_type* values, null_bitmap_ref_t is_null, size_t count)
+			{
+				target._bind_blob_result_array(index, values, is_null, count);
+			}
+
+	private:
+		const char* _value_ptr;
+		size_t _len;
+	};
+
+	template<typename Context, typename Db, typename FieldSpec>
+		struct serializer_t<Context, result_field_t<blob, Db, FieldSpec>>
+		{
+			using _serialize_check = consistent_t;
+			using T = result_field_t<blob, Db, FieldSpec>;
+
+			static Context& _(const T& t, Context& context)
+			{
+				if (t.is_null() and not null_is_trivial_value_t<T>::value)
+				{
+					context << "NULL";
+				}
+				else
+				{
+					const auto bytes = t.view();
+					serialize_hex(bytes.data(), bytes.size(), context);
+				}
+				return context;
+			}
+		};
+
+	template<typename Db, typename FieldSpec>
+		inline std::ostream& operator<<(std::ostream& os, const result_field_t<blob, Db, FieldSpec>& e)
+		{
+			if (e.is_null() and not null_is_trivial_value_t<FieldSpec>::value)
+			{
+				return os << "NULL";
+			}
+			else
+			{
+				static constexpr const char digits[] = "0123456789ABCDEF";
+				for (const auto byte : e.view())
+				{
+					os << digits[byte >> 4] << digits[byte & 0x0F];
+				}
+				return os;
+			}
+		}
+}
+#endif
@@ -67,6 +67,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const _cpp_value_type& val)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				_value = val;
 				_is_null = false;
 				return *this;
@@ -74,6 +76,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const tvin_t<wrap_operand_t<_cpp_value_type>>& t)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				if (t._is_trivial())
 				{
 					_value = false;
@@ -89,6 +93,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const std::nullptr_t&)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				_value = false;
 				_is_null = true;
 				return *this;
@@ -109,12 +115,39 @@ namespace sqlpp
 			template<typename Target>
 				void _bind(Target& target, size_t index) const
 				{
-					target._bind_boolean_parameter(index, &_value, _is_null);
+					_is_dirty = false;
+					if (_bound_value)
+						target._bind_boolean_parameter(index, _bound_value, false);
+					else
+						target._bind_boolean_parameter(index, &_value, _is_null);
 				}
 
+			template<typename Target>
+				static void _bind_array(Target& target, size_t index, const signed char* values, null_bitmap_ref_t is_null, size_t count)
+				{
+					target._bind_boolean_parameter_array(index, values, is_null, count);
+				}
+
+			// Modified since the last _bind(), see parameter_list_t::_bind(). Values owned by the caller might change any time.
+			bool _is_modified() const
+			{
+				return _is_dirty or _bound_value;
+			}
+
+			// Bind a value owned by the caller instead, see parameter_binding.h
+			using _bind_value_type = signed char;
+
+			void _bind_to(const _bind_value_type* value)
+			{
+				_is_dirty = true;
+				_bound_value = value;
+			}
+
 		private:
 			signed char _value;
 			bool _is_null;
+			const _bind_value_type* _bound_value = nullptr;
+			mutable detail::dirty_flag_t _is_dirty;
 		};
 
 	// boolean expression operators
@@ -156,50 +189,30 @@ namespace sqlpp
 
 	// boolean result field
 	template<typename Db, typename FieldSpec>
-		struct result_field_t<boolean, Db, FieldSpec>: public result_field_methods_t<result_field_t<boolean, Db, FieldSpec>>
+		struct result_field_t<boolean, Db, FieldSpec>: public result_field_methods_t<result_field_t<boolean, Db, FieldSpec>>,
+		                                           private detail::result_null_indicator_of<FieldSpec>
 	{
 		static_assert(std::is_same<value_type_of<FieldSpec>, boolean>::value, "field type mismatch");
 		using _cpp_value_type = typename boolean::_cpp_value_type;
+		using _bind_value_type = signed char; // element type of column arrays, as for _bind_boolean_result
 
 		result_field_t():
-			_is_valid(false),
-			_is_null(true),
 			_value(false)
 		{}
 
-		void _validate()
-		{
-			_is_valid = true;
-		}
-
-		void _invalidate()
-		{
-			_is_valid = false;
-			_is_null = true;
-			_value = 0;
-		}
-
 		bool is_null() const
 		{ 
-			if (not _is_valid)
-				throw exception("accessing is_null in non-existing row");
-			return _is_null; 
+			return this->_null();
 		}
 
 		bool _is_trivial() const
 		{
-			if (not _is_valid)
-				throw exception("accessing is_null in non-existing row");
-
 			return value() == false;
 		}
 
 		_cpp_value_type value() const
 		{
-			if (not _is_valid)
-				throw exception("accessing value in non-existing row");
-
-			if (_is_null)
+			if (this->_null())
 			{
 				if (enforce_null_result_treatment_t<Db>::value and not null_is_trivial_value_t<FieldSpec>::value)
 				{
@@ -214,15 +227,23 @@ namespace sqlpp
 		}
 
 		template<typename Target>
-			void _bind(Target& target, size_t i)
+			void _bind(Target& target, size_t i, const detail::result_null_binding_t& nulls)
+			{
+				target._bind_boolean_result(i, &_value, nulls._indicator(i));
+				this->_attach_nulls(nulls, i);
+			}
+
+		using detail::result_null_indicator_of<FieldSpec>::_attach_nulls;
+
+		// Column arrays for fetching batches of rows, see column_batch.h
+		template<typename Target>
+			static void _bind_array(Target& target, size_t index, _bind_value_type* values, null_bitmap_ref_t is_null, size_t count)
 			{
-				target._bind_boolean_result(i, &_value, &_is_null);
+				target._bind_boolean_result_array(index, values, is_null, count);
 			}
 
 	private:
-		bool _is_valid;
-		bool _is_null;
-		signed char _value;
+		_bind_value_type _value;
 	};
 
 	template<typename Db, typename FieldSpec>
@@ -37,6 +37,7 @@ namespace sqlpp
 		{
 			using _traits = make_traits<boolean, tag::is_expression>;
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 
 			template<typename Expr>
 			boolean_expression_t(Expr expr):
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_CHUNKED_CONTEXT_H
+#define SQLPP_CHUNKED_CONTEXT_H
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <sqlpp11/serializer_context.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/interpretable.h>
+#include <sqlpp11/named_interpretable.h>
+#include <sqlpp11/detail/number_format.h>
+
+namespace sqlpp
+{
+	// One segment of a serialized statement, laid out like an iovec
+	struct chunk_t
+	{
+		const char* data;
+		std::size_t size;
+	};
+
+	// Serializes a statement into a sequence of chunks instead of one contiguous string.
+	// Text is copied into fixed size blocks which are never reallocated. Long cached static
+	// statement parts (see append_static_sql()) are referenced in place instead of being copied.
+	// Chunks are valid as long as the context lives.
+	class chunked_context_t
+	{
+	public:
+		using _cache_static_sql = cache_static_sql_for<chunked_context_t>;
+
+		static constexpr std::size_t block_size = 64 * 1024;
+		// Shorter text is copied, an extra chunk would cost more than it saves
+		static constexpr std::size_t min_reference_size = 64;
+
+		chunked_context_t() = default;
+		chunked_context_t(const chunked_context_t&) = delete;
+		chunked_context_t(chunked_context_t&&) = default;
+		chunked_context_t& operator=(const chunked_context_t&) = delete;
+		chunked_context_t& operator=(chunked_context_t&&) = default;
+		~chunked_context_t() = default;
+
+		chunked_context_t& operator<<(char c)
+		{
+			return append(&c, 1);
+		}
+
+		template<typename T>
+			auto operator<<(T s)
+			-> typename std::enable_if<std::is_same<T, const char*>::value or std::is_same<T, char*>::value, chunked_context_t&>::type
+			{
+				return append(s, std::strlen(s));
+			}
+
+		chunked_context_t& operator<<(const std::string& s)
+		{
+			return append(s.data(), s.size());
+		}
+
+		chunked_context_t& operator<<(bool b)
+		{
+			return append(b ? "1" : "0", 1);
+		}
+
+		template<typename T>
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_integral<T>::value and std::is_signed<T>::value, chunked_context_t&>::type
+			{
+				char s[detail::max_number_chars];
+				return append(s, static_cast<std::size_t>(detail::format_integral(s, static_cast<std::int64_t>(t)) - s));
+			}
+
+		template<typename T>
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_integral<T>::value and std::is_unsigned<T>::value, chunked_context_t&>::type
+			{
+				char s[detail::max_number_chars];
+				return append(s, static_cast<std::size_t>(detail::format_unsigned(s, static_cast<std::uint64_t>(t)) - s));
+			}
+
+		template<typename T>
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_floating_point<T>::value, chunked_context_t&>::type
+			{
+				char s[detail::max_number_chars];
+				return append(s, static_cast<std::size_t>(detail::format_floating_point(s, static_cast<double>(t)) - s));
+			}
+
+		// Copies the text into the current block
+		chunked_context_t& append(const char* s, std::size_t len)
+		{
+			if (len == 0)
+			{
+				return *this;
+			}
+			if (_blocks.empty() or _block_size - _block_pos < len)
+			{
+				_new_block(len);
+			}
+			const auto target = _blocks.back().get() + _block_pos;
+			std::memcpy(target, s, len);
+			_block_pos += len;
+			_size += len;
+			if (_extends_last_chunk)
+			{
+				_chunks.back().size += len;
+			}
+			else
+			{
+				_chunks.push_back({target, len});
+				_extends_last_chunk = true;
+			}
+			return *this;
+		}
+
+		// The caller guarantees that the text outlives the context
+		chunked_context_t& append_static(const char* s, std::size_t len)
+		{
+			if (len < min_reference_size)
+			{
+				return append(s, len);
+			}
+			_chunks.push_back({s, len});
+			_size += len;
+			_extends_last_chunk = false;
+			return *this;
+		}
+
+		chunked_context_t& append_escaped(const char* s, std::size_t len)
+		{
+			const auto end = s + len;
+			while (const auto quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s))))
+			{
+				append(s, static_cast<std::size_t>(quote - s) + 1);
+				append("'", 1);
+				s = quote + 1;
+			}
+			return append(s, static_cast<std::size_t>(end - s));
+		}
+
+		static std::string escape(const std::string& arg)
+		{
+			return serializer_context_t::escape(arg);
+		}
+
+		const std::vector<chunk_t>& chunks() const
+		{
+			return _chunks;
+		}
+
+		std::size_t size() const
+		{
+			return _size;
+		}
+
+		std::string str() const
+		{
+			std::string result;
+			result.reserve(_size);
+			for (const auto& chunk : _chunks)
+			{
+				result.append(chunk.data, chunk.size);
+			}
+			return result;
+		}
+
+	private:
+		void _new_block(std::size_t min_size)
+		{
+			_block_size = min_size > block_size ? min_size : block_size;
+			_blocks.emplace_back(new char[_block_size]);
+			_block_pos = 0;
+			_extends_last_chunk = false;
+		}
+
+		std::vector<std::unique_ptr<char[]>> _blocks;
+		std::vector<chunk_t> _chunks;
+		std::size_t _block_size = 0;
+		std::size_t _block_pos = 0;
+		std::size_t _size = 0;
+		bool _extends_last_chunk = false;
+	};
+
+	// Dynamic parts are type erased and can only be serialized into serializer_context_t
+	template<typename Database>
+		struct serializer_t<chunked_context_t, interpretable_t<Database>>
+		{
+			using _serialize_check = consistent_t;
+			using T = interpretable_t<Database>;
+
+			static chunked_context_t& _(const T& t, chunked_context_t& context)
+			{
+				serializer_context_t scratch;
+				serialize(t, scratch);
+				return context.append(scratch.data(), scratch.size());
+			}
+		};
+
+	template<typename Database>
+		struct serializer_t<chunked_context_t, named_interpretable_t<Database>>
+		{
+			using _serialize_check = consistent_t;
+			using T = named_interpretable_t<Database>;
+
+			static chunked_context_t& _(const T& t, chunked_context_t& context)
+			{
+				serializer_context_t scratch;
+				serialize(t, scratch);
+				return context.append(scratch.data(), scratch.size());
+			}
+		};
+}
+
+#endif
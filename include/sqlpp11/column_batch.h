@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_COLUMN_BATCH_H
+#define SQLPP_COLUMN_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <sqlpp11/result_row_fwd.h>
+#include <sqlpp11/field_spec.h>
+#include <sqlpp11/result_field.h>
+#include <sqlpp11/detail/index_sequence.h>
+
+namespace sqlpp
+{
+	// The values of one selected column for a batch of rows plus a packed null bitmap
+	template<typename ResultField>
+		struct result_column_t
+		{
+			// Same element type as single value binds, e.g. signed char for booleans
+			using _value_type = typename ResultField::_bind_value_type;
+
+			explicit result_column_t(std::size_t capacity):
+				_values(new _value_type[capacity]()),
+				_null_bitmap(new std::uint8_t[null_bitmap_ref_t::bytes(capacity)]())
+			{}
+
+			const _value_type* values() const
+			{
+				return _values.get();
+			}
+
+			// One bit per row, see null_bitmap.h
+			const std::uint8_t* null_bitmap() const
+			{
+				return _null_bitmap.get();
+			}
+
+			bool is_null(std::size_t row) const
+			{
+				return null_bitmap_ref_t(_null_bitmap.get()).test(row);
+			}
+
+			const _value_type& operator[](std::size_t row) const
+			{
+				return _values[row];
+			}
+
+			void _set(std::size_t row, const ResultField& field)
+			{
+				const auto is_null = field.is_null();
+				null_bitmap_ref_t(_null_bitmap.get()).set(row, is_null);
+				_values[row] = is_null ? _value_type{} : field.value();
+			}
+
+			template<typename Target>
+				void _bind(Target& target, std::size_t index, std::size_t offset, std::size_t count)
+				{
+					ResultField::_bind_array(target, index, _values.get() + offset, null_bitmap_ref_t(_null_bitmap.get(), offset), count);
+				}
+
+			std::unique_ptr<_value_type[]> _values;
+			std::unique_ptr<std::uint8_t[]> _null_bitmap;
+		};
+
+	template<typename ResultRow>
+		struct column_batch_t
+		{
+			static_assert(wrong_t<column_batch_t>::value, "column batches require the result row of a static select");
+		};
+
+	// Struct of arrays for up to capacity() rows of a result, see result_t::fetch_columns()
+	template<typename Db, typename... FieldSpecs>
+		struct column_batch_t<result_row_t<Db, FieldSpecs...>>
+		{
+			using _result_row_t = result_row_t<Db, FieldSpecs...>;
+			using _column_tuple_t = std::tuple<result_column_t<result_field_t<value_type_of<FieldSpecs>, Db, FieldSpecs>>...>;
+
+			explicit column_batch_t(std::size_t capacity):
+				_capacity(capacity),
+				_columns(((void)sizeof(FieldSpecs), capacity)...)
+			{}
+
+			std::size_t size() const
+			{
+				return _size;
+			}
+
+			std::size_t capacity() const
+			{
+				return _capacity;
+			}
+
+			bool empty() const
+			{
+				return _size == 0;
+			}
+
+			// The column of the Ith selected field
+			template<std::size_t I>
+				const typename std::tuple_element<I, _column_tuple_t>::type& column() const
+				{
+					return std::get<I>(_columns);
+				}
+
+			void _clear()
+			{
+				_size = 0;
+			}
+
+			void _push_back(const _result_row_t& row)
+			{
+				_push_back_impl(row, detail::make_index_sequence<sizeof...(FieldSpecs)>{});
+				++_size;
+			}
+
+			// Bulk retrieval: connectors bind the free part of the arrays, fetch rows into them
+			// and report the number of rows via _grow(), see connector_api/bind_result.h
+			std::size_t _free() const
+			{
+				return _capacity - _size;
+			}
+
+			template<typename Target>
+				void _bind(Target& target)
+				{
+					_bind_impl(target, detail::make_index_sequence<sizeof...(FieldSpecs)>{});
+				}
+
+			void _grow(std::size_t rows)
+			{
+				_size += rows;
+			}
+
+		private:
+			template<size_t... Is>
+				void _push_back_impl(const _result_row_t& row, const detail::index_sequence<Is...>&)
+				{
+					using swallow = int[];  // see interpret_tuple.h
+					(void) swallow{0, (std::get<Is>(_columns)._set(_size, static_cast<const typename FieldSpecs::_alias_t::template _member_t<result_field_t<value_type_of<FieldSpecs>, Db, FieldSpecs>>&>(row)()), 0)...};
+				}
+
+			template<typename Target, size_t... Is>
+				void _bind_impl(Target& target, const detail::index_sequence<Is...>&)
+				{
+					using swallow = int[];
+					(void) swallow{0, (std::get<Is>(_columns)._bind(target, Is, _size, _free()), 0)...};
+				}
+
+			std::size_t _capacity;
+			std::size_t _size = 0;
+			_column_tuple_t _columns;
+		};
+
+	template<typename DbResult, typename ResultRow>
+		class result_t;
+
+	template<typename DbResult, typename ResultRow>
+		column_batch_t<ResultRow> make_column_batch(const result_t<DbResult, ResultRow>&, std::size_t capacity)
+		{
+			return column_batch_t<ResultRow>(capacity);
+		}
+
+	namespace detail
+	{
+		// Connectors with bulk retrieval fill the remaining rows of the batch in one go
+		template<typename DbResult, typename ResultRow, typename ColumnBatch>
+			auto fetch_rows_impl(DbResult& result, ResultRow& row, ColumnBatch& batch, int)
+			-> decltype(result._fetch_columns(batch), void())
+			{
+				batch._push_back(row);
+				if (batch._free())
+					result._fetch_columns(batch);
+				result.next(row);
+			}
+
+		template<typename DbResult, typename ResultRow, typename ColumnBatch>
+			void fetch_rows_impl(DbResult& result, ResultRow& row, ColumnBatch& batch, long)
+			{
+				do
+				{
+					batch._push_back(row);
+					result.next(row);
+				}
+				while (row and batch._free());
+			}
+
+		template<typename DbResult, typename ResultRow, typename ColumnBatch>
+			std::size_t fetch_columns(DbResult& result, ResultRow& row, ColumnBatch& batch)
+			{
+				batch._clear();
+				if (row and batch._free())
+					fetch_rows_impl(result, row, batch, 0);
+				return batch.size();
+			}
+	}
+}
+
+#endif
@@ -46,6 +46,7 @@ namespace sqlpp
 			using _nodes = detail::type_vector<>;
 			using _required_ctes = detail::make_joined_set_t<required_ctes_of<Lhs>, required_ctes_of<Rhs>>;
 			using _parameters = detail::type_vector_cat_t<parameters_of<Lhs>, parameters_of<Rhs>>;
+			using _has_runtime_data = logic::any_t<has_runtime_data_t<Lhs>::value, has_runtime_data_t<Rhs>::value>;
 
 			cte_union_t(Lhs lhs, Rhs rhs):
 				_lhs(lhs),
@@ -133,6 +134,7 @@ namespace sqlpp
 			using _nodes = detail::type_vector<>;
 			using _required_ctes = detail::make_joined_set_t<required_ctes_of<Statement>, detail::type_set<Alias>>;
 			using _parameters = parameters_of<Statement>;
+			using _has_runtime_data = has_runtime_data_t<Statement>;
 
 			using _alias_t = typename Alias::_alias_t;
 			constexpr static bool _is_recursive = detail::is_element_of<Alias, required_ctes_of<Statement>>::value;
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DETAIL_CHAR_BUFFER_H
+#define SQLPP_DETAIL_CHAR_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// A growable, contiguous char buffer which keeps the first InlineCapacity bytes
+		// in the object itself, so that short statements do not allocate at all.
+		template<std::size_t InlineCapacity>
+			class char_buffer
+			{
+			public:
+				char_buffer():
+					_data(_inline),
+					_size(0),
+					_capacity(InlineCapacity)
+				{}
+
+				char_buffer(const char_buffer& rhs):
+					char_buffer()
+				{
+					append(rhs._data, rhs._size);
+				}
+
+				char_buffer(char_buffer&& rhs):
+					char_buffer()
+				{
+					_take(rhs);
+				}
+
+				char_buffer& operator=(const char_buffer& rhs)
+				{
+					if (this != &rhs)
+					{
+						clear();
+						append(rhs._data, rhs._size);
+					}
+					return *this;
+				}
+
+				char_buffer& operator=(char_buffer&& rhs)
+				{
+					if (this != &rhs)
+					{
+						_release();
+						_take(rhs);
+					}
+					return *this;
+				}
+
+				~char_buffer()
+				{
+					_release();
+				}
+
+				const char* data() const
+				{
+					return _data;
+				}
+
+				std::size_t size() const
+				{
+					return _size;
+				}
+
+				std::size_t capacity() const
+				{
+					return _capacity;
+				}
+
+				bool empty() const
+				{
+					return _size == 0;
+				}
+
+				void clear()
+				{
+					_size = 0;
+				}
+
+				void reserve(std::size_t capacity)
+				{
+					if (capacity > _capacity)
+						_reallocate(capacity);
+				}
+
+				void push_back(char c)
+				{
+					if (_size == _capacity)
+						_grow(_size + 1);
+					_data[_size++] = c;
+				}
+
+				void append(const char* s, std::size_t len)
+				{
+					if (_size + len > _capacity)
+						_grow(_size + len);
+					std::memcpy(_data + _size, s, len);
+					_size += len;
+				}
+
+				std::string str() const
+				{
+					return std::string(_data, _size);
+				}
+
+			private:
+				void _grow(std::size_t required)
+				{
+					const auto doubled = 2 * _capacity;
+					_reallocate(required > doubled ? required : doubled);
+				}
+
+				void _reallocate(std::size_t capacity)
+				{
+					auto data = new char[capacity];
+					std::memcpy(data, _data, _size);
+					_release();
+					_data = data;
+					_capacity = capacity;
+				}
+
+				void _release()
+				{
+					if (_data != _inline)
+						delete[] _data;
+					_data = _inline;
+					_capacity = InlineCapacity;
+				}
+
+				void _take(char_buffer& rhs)
+				{
+					if (rhs._data == rhs._inline)
+					{
+						std::memcpy(_inline, rhs._inline, rhs._size);
+					}
+					else
+					{
+						_data = rhs._data;
+						_capacity = rhs._capacity;
+						rhs._data = rhs._inline;
+						rhs._capacity = InlineCapacity;
+					}
+					_size = rhs._size;
+					rhs._size = 0;
+				}
+
+				char _inline[InlineCapacity];
+				char* _data;
+				std::size_t _size;
+				std::size_t _capacity;
+			};
+	}
+}
+
+#endif
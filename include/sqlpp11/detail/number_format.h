@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DETAIL_NUMBER_FORMAT_H
+#define SQLPP_DETAIL_NUMBER_FORMAT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <clocale>
+#if __cplusplus >= 201703L and defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// Number formatting for SQL literals, independent of the global locale.
+		// The functions write into [first, first + max_number_chars) and return the end of the output.
+		static constexpr std::size_t max_number_chars = 32;
+
+		inline char* format_unsigned(char* first, std::uint64_t value)
+		{
+			char digits[20];
+			auto last = digits + sizeof(digits);
+			auto pos = last;
+			do
+			{
+				*--pos = static_cast<char>('0' + value % 10);
+				value /= 10;
+			}
+			while (value);
+			const auto len = static_cast<std::size_t>(last - pos);
+			std::memcpy(first, pos, len);
+			return first + len;
+		}
+
+		inline char* format_integral(char* first, std::int64_t value)
+		{
+			if (value < 0)
+			{
+				*first++ = '-';
+				return format_unsigned(first, ~static_cast<std::uint64_t>(value) + 1);
+			}
+			return format_unsigned(first, static_cast<std::uint64_t>(value));
+		}
+
+		// Shortest representation that reads back as the same double.
+		// Without std::to_chars, the shortest of %.15g, %.16g and %.17g that does.
+		inline char* format_floating_point(char* first, double value)
+		{
+#if defined(__cpp_lib_to_chars)
+			return std::to_chars(first, first + max_number_chars, value).ptr;
+#else
+			char buffer[2 * max_number_chars];
+			int len = 0;
+			for (int precision = 15; precision <= 17; ++precision)
+			{
+				len = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+				if (len <= 0 or precision == 17 or std::strtod(buffer, nullptr) == value)
+				{
+					break;
+				}
+			}
+			const auto buffer_last = buffer + (len > 0 ? len : 0);
+
+			// snprintf and strtod use the decimal point of the C locale, it might have more than one character
+			const auto point = std::localeconv()->decimal_point;
+			const auto point_len = point ? std::strlen(point) : 0;
+			auto last = first;
+			for (auto pos = buffer; pos != buffer_last; )
+			{
+				if (point_len and static_cast<std::size_t>(buffer_last - pos) >= point_len and std::memcmp(pos, point, point_len) == 0)
+				{
+					*last++ = '.';
+					pos += point_len;
+				}
+				else
+				{
+					*last++ = *pos++;
+				}
+			}
+			return last;
+#endif
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_DETAIL_POLYMORPHIC_VALUE_H
+#define SQLPP_DETAIL_POLYMORPHIC_VALUE_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		template<typename Impl>
+			struct in_place_type_t {};
+
+		// Holds an immutable object derived from Base.
+		// Objects of up to InlineCapacity bytes are stored in place, larger ones are
+		// allocated on the heap and shared between copies (they are immutable after all).
+		template<typename Base, std::size_t InlineCapacity>
+			class polymorphic_value_t
+			{
+				enum class _operation_t
+				{
+					copy,
+					move,
+					destroy
+				};
+				using _manage_t = const Base* (*)(_operation_t operation, void* from, void* to);
+
+				template<typename Impl>
+					static const Base* _manage_inline(_operation_t operation, void* from, void* to)
+					{
+						switch (operation)
+						{
+						case _operation_t::copy:
+							return ::new (to) Impl(*static_cast<const Impl*>(from));
+						case _operation_t::move:
+							return ::new (to) Impl(std::move(*static_cast<Impl*>(from)));
+						case _operation_t::destroy:
+							static_cast<Impl*>(from)->~Impl();
+						}
+						return nullptr;
+					}
+
+			public:
+				template<typename Impl>
+					using is_inline = std::integral_constant<bool,
+								sizeof(Impl) <= InlineCapacity 
+								and alignof(Impl) <= alignof(std::max_align_t)
+								and std::is_nothrow_move_constructible<Impl>::value>;
+
+				template<typename Impl, typename... Args>
+					polymorphic_value_t(in_place_type_t<Impl>, Args&&... args)
+					{
+						_emplace<Impl>(is_inline<Impl>{}, std::forward<Args>(args)...);
+					}
+
+				polymorphic_value_t(const polymorphic_value_t& rhs):
+					_heap(rhs._heap),
+					_ptr(_heap.get())
+				{
+					if (rhs._manage)
+					{
+						_ptr = rhs._manage(_operation_t::copy, rhs._inline_object(), &_buffer);
+						_manage = rhs._manage;
+					}
+				}
+
+				polymorphic_value_t(polymorphic_value_t&& rhs) noexcept:
+					_heap(std::move(rhs._heap)),
+					_ptr(_heap.get())
+				{
+					if (rhs._manage)
+					{
+						_ptr = rhs._manage(_operation_t::move, rhs._inline_object(), &_buffer);
+						_manage = rhs._manage;
+					}
+					else
+					{
+						rhs._ptr = nullptr; // the heap object went with _heap
+					}
+				}
+
+				polymorphic_value_t& operator=(const polymorphic_value_t& rhs)
+				{
+					if (this != &rhs)
+					{
+						polymorphic_value_t copy(rhs);
+						*this = std::move(copy);
+					}
+					return *this;
+				}
+
+				polymorphic_value_t& operator=(polymorphic_value_t&& rhs) noexcept
+				{
+					if (this != &rhs)
+					{
+						_reset();
+						_heap = std::move(rhs._heap);
+						_ptr = _heap.get();
+						if (rhs._manage)
+						{
+							_ptr = rhs._manage(_operation_t::move, rhs._inline_object(), &_buffer);
+							_manage = rhs._manage;
+						}
+						else
+						{
+							rhs._ptr = nullptr;
+						}
+					}
+					return *this;
+				}
+
+				~polymorphic_value_t()
+				{
+					_reset();
+				}
+
+				const Base* operator->() const
+				{
+					return _ptr;
+				}
+
+				const Base& operator*() const
+				{
+					return *_ptr;
+				}
+
+				bool _is_inline() const
+				{
+					return _manage != nullptr;
+				}
+
+			private:
+				template<typename Impl, typename... Args>
+					void _emplace(const std::true_type&, Args&&... args)
+					{
+						_ptr = ::new (static_cast<void*>(&_buffer)) Impl(std::forward<Args>(args)...);
+						_manage = &_manage_inline<Impl>;
+					}
+
+				template<typename Impl, typename... Args>
+					void _emplace(const std::false_type&, Args&&... args)
+					{
+						_heap = std::make_shared<const Impl>(std::forward<Args>(args)...);
+						_ptr = _heap.get();
+					}
+
+				// The inline object starts at the buffer, not necessarily at the Base subobject
+				void* _inline_object() const
+				{
+					return const_cast<void*>(static_cast<const void*>(&_buffer));
+				}
+
+				void _reset()
+				{
+					if (_manage)
+					{
+						_manage(_operation_t::destroy, &_buffer, nullptr);
+						_manage = nullptr;
+					}
+					_heap.reset();
+					_ptr = nullptr;
+				}
+
+				typename std::aligned_storage<InlineCapacity, alignof(std::max_align_t)>::type _buffer;
+				_manage_t _manage = nullptr;
+				std::shared_ptr<const Base> _heap;
+				const Base* _ptr = nullptr;
+			};
+	}
+}
+
+#endif
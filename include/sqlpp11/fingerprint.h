@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_FINGERPRINT_H
+#define SQLPP_FINGERPRINT_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/serialize.h>
+
+#if defined(_MSC_VER)
+#define SQLPP_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define SQLPP_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// FNV-1a, 64 bit
+		constexpr std::uint64_t fingerprint_basis = 14695981039346656037ull;
+		constexpr std::uint64_t fingerprint_prime = 1099511628211ull;
+
+		inline std::uint64_t fingerprint_append(std::uint64_t hash, const char* s, std::size_t len)
+		{
+			for (std::size_t i = 0; i < len; ++i)
+			{
+				hash = (hash ^ static_cast<unsigned char>(s[i])) * fingerprint_prime;
+			}
+			return hash;
+		}
+
+		inline std::uint64_t fingerprint_append(std::uint64_t hash, std::uint64_t value)
+		{
+			for (int i = 0; i < 8; ++i)
+			{
+				hash = (hash ^ ((value >> (8 * i)) & 0xff)) * fingerprint_prime;
+			}
+			return hash;
+		}
+
+		// The signature contains the complete type, i.e. all tables, columns, aliases and operators.
+		// It is the same in every build with the same compiler. It is hashed once per type, at
+		// runtime: hashing a signature of several thousand characters in a C++11 constant
+		// expression would exceed the recursion limits of the compilers.
+		template<typename T>
+			std::uint64_t type_fingerprint()
+			{
+				static const std::uint64_t hash = fingerprint_append(fingerprint_basis, SQLPP_FUNCTION_SIGNATURE, std::strlen(SQLPP_FUNCTION_SIGNATURE));
+				return hash;
+			}
+	}
+
+	// Walks an expression and collects the shape of its runtime parts: Dynamic parts contribute
+	// the fingerprints of their expressions, verbatim text contributes its content.
+	// Literal values (numbers, escaped text) are ignored.
+	struct fingerprint_context_t
+	{
+		explicit fingerprint_context_t(std::uint64_t fingerprint):
+			_fingerprint(fingerprint)
+		{}
+
+		fingerprint_context_t& operator<<(char)
+		{
+			return *this;
+		}
+
+		fingerprint_context_t& operator<<(const char*)
+		{
+			return *this;
+		}
+
+		fingerprint_context_t& operator<<(const std::string& s)
+		{
+			_fingerprint = detail::fingerprint_append(_fingerprint, s.data(), s.size());
+			return *this;
+		}
+
+		template<typename T>
+			auto operator<<(T)
+			-> typename std::enable_if<std::is_arithmetic<T>::value, fingerprint_context_t&>::type
+			{
+				return *this;
+			}
+
+		fingerprint_context_t& append_escaped(const char*, std::size_t)
+		{
+			return *this;
+		}
+
+		void add(std::uint64_t fingerprint)
+		{
+			_fingerprint = detail::fingerprint_append(_fingerprint, fingerprint);
+		}
+
+		std::uint64_t _fingerprint;
+	};
+
+	namespace detail
+	{
+		template<typename T>
+			std::uint64_t fingerprint_impl(const T&, std::uint64_t static_fingerprint, const std::false_type&)
+			{
+				return static_fingerprint;
+			}
+
+		template<typename T>
+			std::uint64_t fingerprint_impl(const T& t, std::uint64_t static_fingerprint, const std::true_type&)
+			{
+				fingerprint_context_t context{static_fingerprint};
+				serialize(t, context);
+				return context._fingerprint;
+			}
+	}
+
+	// A 64 bit hash of the shape of a statement or expression, e.g. as key for caches, metrics or logs.
+	// The static part is computed once per type. Dynamic parts and verbatim text are
+	// added at runtime. Literal values are ignored, i.e. statements which differ in literal values only
+	// have the same fingerprint.
+	template<typename T>
+		std::uint64_t fingerprint(const T& t)
+		{
+			return detail::fingerprint_impl(t, detail::type_fingerprint<T>(), has_runtime_data_t<T>{});
+		}
+}
+
+#endif
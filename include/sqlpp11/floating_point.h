@@ -32,6 +32,7 @@
 #include <sqlpp11/concepts.h>
 #include <sqlpp11/exception.h>
 #include <sqlpp11/result_field.h>
+#include <sqlpp11/serialize.h>
 
 namespace sqlpp
 {
@@ -65,6 +66,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const _cpp_value_type& val)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				_value = val;
 				_is_null = false;
 				return *this;
@@ -72,6 +75,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const tvin_t<wrap_operand_t<_cpp_value_type>>& t)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				if (t._is_trivial())
 				{
 					_value = 0;
@@ -87,6 +92,8 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const std::nullptr_t&)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
 				_value = 0;
 				_is_null = true;
 				return *this;
@@ -107,12 +114,39 @@ namespace sqlpp
 			template<typename Target>
 				void _bind(Target& target, size_t index) const
 				{
-					target._bind_floating_point_parameter(index, &_value, _is_null);
+					_is_dirty = false;
+					if (_bound_value)
+						target._bind_floating_point_parameter(index, _bound_value, false);
+					else
+						target._bind_floating_point_parameter(index, &_value, _is_null);
 				}
 
+			template<typename Target>
+				static void _bind_array(Target& target, size_t index, const _cpp_value_type* values, null_bitmap_ref_t is_null, size_t count)
+				{
+					target._bind_floating_point_parameter_array(index, values, is_null, count);
+				}
+
+			// Modified since the last _bind(), see parameter_list_t::_bind(). Values owned by the caller might change any time.
+			bool _is_modified() const
+			{
+				return _is_dirty or _bound_value;
+			}
+
+			// Bind a value owned by the caller instead, see parameter_binding.h
+			using _bind_value_type = _cpp_value_type;
+
+			void _bind_to(const _bind_value_type* value)
+			{
+				_is_dirty = true;
+				_bound_value = value;
+			}
+
 		private:
 			_cpp_value_type _value;
 			bool _is_null;
+			const _bind_value_type* _bound_value = nullptr;
+			mutable detail::dirty_flag_t _is_dirty;
 		};
 
 	// floating_point expression operators
@@ -213,50 +247,30 @@ namespace sqlpp
 		};
 	// floating_point result field
 	template<typename Db, typename FieldSpec>
-		struct result_field_t<floating_point, Db, FieldSpec>: public result_field_methods_t<result_field_t<floating_point, Db, FieldSpec>>
+		struct result_field_t<floating_point, Db, FieldSpec>: public result_field_methods_t<result_field_t<floating_point, Db, FieldSpec>>,
+		                                           private detail::result_null_indicator_of<FieldSpec>
 		{
 			static_assert(std::is_same<value_type_of<FieldSpec>, floating_point>::value, "field type mismatch");
 			using _cpp_value_type = typename floating_point::_cpp_value_type;
+			using _bind_value_type = _cpp_value_type;
 
 			result_field_t():
-				_is_valid(false),
-				_is_null(true),
 				_value(0)
 			{}
 
-			void _validate()
-			{
-				_is_valid = true;
-			}
-
-			void _invalidate()
-			{
-				_is_valid = false;
-				_is_null = true;
-				_value = 0;
-			}
-
 			bool is_null() const
 			{ 
-				if (not _is_valid)
-					throw exception("accessing is_null in non-existing row");
-			return _is_null; 
+			return this->_null();
 		}
 
 		bool _is_trivial() const
 		{
-			if (not _is_valid)
-				throw exception("accessing is_null in non-existing row");
-
 			return value() == 0;
 		}
 
 		_cpp_value_type value() const
 		{
-			if (not _is_valid)
-				throw exception("accessing value in non-existing row");
-
-			if (_is_null)
+			if (this->_null())
 			{
 				if (enforce_null_result_treatment_t<Db>::value and not null_is_trivial_value_t<FieldSpec>::value)
 				{
@@ -271,21 +285,54 @@ namespace sqlpp
 		}
 
 		template<typename Target>
-			void _bind(Target& target, size_t i)
+			void _bind(Target& target, size_t i, const detail::result_null_binding_t& nulls)
+			{
+				target._bind_floating_point_result(i, &_value, nulls._indicator(i));
+				this->_attach_nulls(nulls, i);
+			}
+
+		using detail::result_null_indicator_of<FieldSpec>::_attach_nulls;
+
+		// Column arrays for fetching batches of rows, see column_batch.h
+		template<typename Target>
+			static void _bind_array(Target& target, size_t index, _bind_value_type* values, null_bitmap_ref_t is_null, size_t count)
 			{
-				target._bind_floating_point_result(i, &_value, &_is_null);
+				target._bind_floating_point_result_array(index, values, is_null, count);
 			}
 
 	private:
-		bool _is_valid;
-		bool _is_null;
 		_cpp_value_type _value;
 	};
 
+	template<typename Context, typename Db, typename FieldSpec>
+		struct serializer_t<Context, result_field_t<floating_point, Db, FieldSpec>>
+		{
+			using _serialize_check = consistent_t;
+			using T = result_field_t<floating_point, Db, FieldSpec>;
+
+			static Context& _(const T& t, Context& context)
+			{
+				if (t.is_null() and not null_is_trivial_value_t<T>::value)
+				{
+					context << "NULL";
+					return context;
+				}
+				return serialize_floating_point(t.value(), context);
+			}
+		};
+
 	template<typename Db, typename FieldSpec>
 		inline std::ostream& operator<<(std::ostream& os, const result_field_t<floating_point, Db, FieldSpec>& e)
 		{
-			return serialize(e, os);
+			// Formatted by the stream, e.g. with std::fixed or std::hex, SQL literals are the business of serialize()
+			if (e.is_null() and not null_is_trivial_value_t<FieldSpec>::value)
+			{
+				return os << "NULL";
+			}
+			else
+			{
+				return os << e.value();
+			}
 		}
 
 }
@@ -83,6 +83,7 @@ namespace sqlpp
 		{
 			using _traits = make_traits<value_type_t<typename Container::value_type>, tag::is_expression>;
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 
 			using _container_t = Container;
 
@@ -116,6 +116,12 @@ namespace sqlpp
 			std::tuple<rhs_t<Assignments>...> _values;
 			interpretable_list_t<Database> _dynamic_columns;
 			interpretable_list_t<Database> _dynamic_values;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_columns, arena);
+				detail::use_arena(_dynamic_values, arena);
+			}
 		};
 
 	struct assert_no_unknown_tables_in_insert_assignments_t
@@ -246,6 +252,7 @@ namespace sqlpp
 		{
 			using _traits = make_traits<no_value_t, tag::is_column_list>;
 			using _nodes = detail::type_vector<Columns...>;
+			using _has_runtime_data = std::true_type;
 
 			using _value_tuple_t = typename column_list_data_t<Columns...>::_value_tuple_t;
 
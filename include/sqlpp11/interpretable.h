@@ -27,11 +27,12 @@
 #ifndef SQLPP_INTERPRETABLE_H
 #define SQLPP_INTERPRETABLE_H
 
-#include <memory>
 #include <sqlpp11/serializer_context.h>
 #include <sqlpp11/parameter_list.h>
 #include <sqlpp11/serialize.h>
 #include <sqlpp11/interpret.h>
+#include <sqlpp11/fingerprint.h>
+#include <sqlpp11/detail/polymorphic_value.h>
 
 namespace sqlpp
 {
@@ -44,7 +45,7 @@ namespace sqlpp
 			template<typename T>
 				interpretable_t(T t):
 					_requires_braces(requires_braces_t<T>::value),
-					_impl(std::make_shared<_impl_t<T>>(t))
+					_impl(detail::in_place_type_t<_impl_t<T>>{}, t)
 			{}
 
 			interpretable_t(const interpretable_t&) = default;
@@ -72,6 +73,12 @@ namespace sqlpp
 				return _impl->interpret(context);
 			}
 
+			// Only computed on demand, e.g. by a statement cache
+			std::uint64_t _fingerprint() const
+			{
+				return _impl->_fingerprint();
+			}
+
 			bool _requires_braces;
 
 		private:
@@ -80,6 +87,7 @@ namespace sqlpp
 				virtual serializer_context_t& serialize(serializer_context_t& context) const = 0;
 				virtual _serializer_context_t& db_serialize(_serializer_context_t& context) const = 0;
 				virtual _interpreter_context_t& interpret(_interpreter_context_t& context) const = 0;
+				virtual std::uint64_t _fingerprint() const = 0;
 			};
 
 			template<typename T>
@@ -108,10 +116,29 @@ namespace sqlpp
 					return context;
 				}
 
+				std::uint64_t _fingerprint() const
+				{
+					return ::sqlpp::fingerprint(_t);
+				}
+
 				T _t;
 			};
 
-			std::shared_ptr<const _impl_base> _impl;
+			// Typical dynamic parts (comparisons, simple boolean combinations) are stored in place
+			detail::polymorphic_value_t<_impl_base, 64> _impl;
+		};
+
+	template<typename Database>
+		struct serializer_t<fingerprint_context_t, interpretable_t<Database>>
+		{
+			using _serialize_check = consistent_t;
+			using T = interpretable_t<Database>;
+
+			static fingerprint_context_t& _(const T& t, fingerprint_context_t& context)
+			{
+				context.add(t._fingerprint());
+				return context;
+			}
 		};
 
 	template<typename Context, typename Database>
@@ -29,13 +29,14 @@
 
 #include <vector>
 #include <sqlpp11/interpretable.h>
+#include <sqlpp11/arena.h>
 
 namespace sqlpp
 {
 	template<typename Db>
 		struct interpretable_list_t
 		{
-			std::vector<interpretable_t<Db>> _serializables;
+			std::vector<interpretable_t<Db>, arena_allocator<interpretable_t<Db>>> _serializables;
 
 			std::size_t size() const
 			{
@@ -50,9 +51,19 @@ namespace sqlpp
 			template<typename Expr>
 				void emplace_back(Expr expr)
 				{
+					// Dynamic lists rarely have more than a few entries, start with room for those
+					if (_serializables.empty())
+					{
+						_serializables.reserve(4);
+					}
 					_serializables.emplace_back(expr);
 				}
 
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::move_to_arena(_serializables, arena);
+			}
+
 		};
 
 	template<>
@@ -79,7 +90,7 @@ namespace sqlpp
 				static Context& _(const T& t, const Separator& separator, Context& context)
 				{
 					bool first = true;
-					for (const auto entry : t._serializables)
+					for (const auto& entry : t._serializables)
 					{
 						if (not first)
 						{
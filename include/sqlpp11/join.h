@@ -68,6 +68,7 @@ namespace sqlpp
 			using _traits = make_traits<no_value_t, tag::is_table, tag::is_join>;
 			using _nodes = detail::type_vector<Lhs, Rhs>;
 			using _can_be_null = std::false_type;
+			using _has_runtime_data = logic::any_t<has_runtime_data_t<Lhs>::value, has_runtime_data_t<Rhs>::value, has_runtime_data_t<On>::value>;
 
 			static_assert(is_table_t<Lhs>::value, "lhs argument for join() has to be a table or join");
 			static_assert(is_table_t<Rhs>::value, "rhs argument for join() has to be a table");
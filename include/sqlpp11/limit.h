@@ -119,6 +119,7 @@ namespace sqlpp
 		{
 			using _traits = make_traits<no_value_t, tag::is_limit>;
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 
 			// Data
 			using _data_t = dynamic_limit_data_t<Database>;
@@ -39,6 +39,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<value_type_of<Expr>, tag::is_expression, tag::is_selectable>;
 		using _nodes = detail::type_vector<Expr, aggregate_function>;
+		using _can_be_null = std::true_type; // NULL for an empty set of rows
 
 		struct _alias_t
 		{
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_NULL_BITMAP_H
+#define SQLPP_NULL_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace sqlpp
+{
+	// Packed NULL indicators, one bit per value, least significant bit first. Set bits are NULL.
+	// Refers to the bits from bit offset on, e.g. the free rows of a column batch.
+	// Connectors fill them via set(), see connector_api/bind_result.h
+	class null_bitmap_ref_t
+	{
+		std::uint8_t* _bits;
+		std::size_t _offset;
+
+	public:
+		explicit null_bitmap_ref_t(std::uint8_t* bits, std::size_t offset = 0):
+			_bits(bits),
+			_offset(offset)
+		{}
+
+		static constexpr std::size_t bytes(std::size_t bit_count)
+		{
+			return (bit_count + 7) / 8;
+		}
+
+		bool test(std::size_t i) const
+		{
+			const auto bit = _offset + i;
+			return _bits[bit / 8] & (1u << (bit % 8));
+		}
+
+		void set(std::size_t i, bool is_null) const
+		{
+			const auto bit = _offset + i;
+			if (is_null)
+				_bits[bit / 8] |= static_cast<std::uint8_t>(1u << (bit % 8));
+			else
+				_bits[bit / 8] &= static_cast<std::uint8_t>(~(1u << (bit % 8)));
+		}
+
+		// Sets count indicators from i on, whole bytes at once, e.g. for a column without NULL values
+		void fill(std::size_t i, std::size_t count, bool is_null) const
+		{
+			for (; count and (_offset + i) % 8; ++i, --count)
+				set(i, is_null);
+			const auto bytes = count / 8;
+			std::memset(_bits + (_offset + i) / 8, is_null ? 0xff : 0, bytes);
+			i += bytes * 8;
+			count -= bytes * 8;
+			for (; count; ++i, --count)
+				set(i, is_null);
+		}
+
+		std::uint8_t* data() const
+		{
+			return _bits;
+		}
+
+		std::size_t offset() const
+		{
+			return _offset;
+		}
+	};
+}
+
+#endif
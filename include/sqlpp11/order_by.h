@@ -53,6 +53,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_expressions, arena);
+			}
 		};
 
 	struct assert_no_unknown_tables_in_order_by_t
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_PARAMETER_BINDING_H
+#define SQLPP_PARAMETER_BINDING_H
+
+#include <tuple>
+#include <type_traits>
+#include <sqlpp11/logic.h>
+#include <sqlpp11/parameter_list.h>
+#include <sqlpp11/detail/index_sequence.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		template<typename MemberTuple, typename Indexes, typename... Members>
+			struct bind_value_types_match;
+
+		template<typename MemberTuple, size_t... Is, typename... Members>
+			struct bind_value_types_match<MemberTuple, index_sequence<Is...>, Members...>
+			{
+				template<size_t I>
+					using _bind_value_type = typename std::decay<decltype(std::declval<const typename std::tuple_element<I, MemberTuple>::type&>()())>::type::_bind_value_type;
+
+				static constexpr bool value = logic::all_t<std::is_same<Members, _bind_value_type<Is>>::value...>::value;
+			};
+	}
+
+	// Binds the parameters of a prepared statement to the members of a struct, in the order of the parameters.
+	// After set(s), executing the statement passes pointers to the members of s to the connector instead of
+	// copying them into the parameters first. Bound parameters are never null. s has to outlive the execution.
+	// Assigning a value or null to a parameter ends its binding.
+	// The member types have to match the types the connector binds, e.g. int64_t for integral parameters,
+	// std::string for text and signed char for boolean.
+	template<typename ParameterList, typename Struct, typename... Members>
+		class parameter_binding_t
+		{
+			using _member_tuple_t = typename ParameterList::_member_tuple_t;
+			using _index_t = detail::make_index_sequence<sizeof...(Members)>;
+
+			static_assert(sizeof...(Members) == ParameterList::size::value, "number of members has to match the number of parameters");
+
+			static_assert(detail::bind_value_types_match<_member_tuple_t, _index_t, Members...>::value, "member types have to match the bind value types of the parameters");
+
+		public:
+			parameter_binding_t(ParameterList& params, Members Struct::*... members):
+				_params(params),
+				_members(members...)
+			{}
+
+			void set(const Struct& s)
+			{
+				_set(&s, _index_t{});
+			}
+
+			// The parameters use their own values again
+			void reset()
+			{
+				_set(nullptr, _index_t{});
+			}
+
+		private:
+			template<size_t... Is>
+				void _set(const Struct* s, const detail::index_sequence<Is...>&)
+				{
+					using swallow = int[];  // see interpret_tuple.h
+					(void) swallow{0, (static_cast<typename std::tuple_element<Is, _member_tuple_t>::type&>(_params)()._bind_to(s ? &(s->*std::get<Is>(_members)) : nullptr), 0)...};
+				}
+
+			ParameterList& _params;
+			std::tuple<Members Struct::*...> _members;
+		};
+
+	template<typename PreparedStatement, typename Struct, typename... Members>
+		auto bind_members(PreparedStatement& prepared, Members Struct::*... members)
+		-> parameter_binding_t<typename PreparedStatement::_parameter_list_t, Struct, Members...>
+		{
+			return {prepared.params, members...};
+		}
+}
+
+#endif
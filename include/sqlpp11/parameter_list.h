@@ -28,12 +28,33 @@
 #define SQLPP_PARAMETER_LIST_H
 
 #include <tuple>
+#include <type_traits>
 #include <sqlpp11/concepts.h>
 #include <sqlpp11/wrong.h>
 #include <sqlpp11/detail/index_sequence.h>
 
 namespace sqlpp
 {
+	namespace detail
+	{
+		template<typename Db, typename = void>
+			struct keeps_parameter_bindings_impl
+			{
+				using type = std::false_type;
+			};
+
+		template<typename Db>
+			struct keeps_parameter_bindings_impl<Db, typename std::enable_if<Db::_keeps_parameter_bindings::value>::type>
+			{
+				using type = std::true_type;
+			};
+	}
+
+	// Connectors whose prepared statements keep bound values between executions
+	// declare _keeps_parameter_bindings, see connector_api/connection.h
+	template<typename Db>
+		using keeps_parameter_bindings_t = typename detail::keeps_parameter_bindings_impl<Db>::type;
+
 	template<typename T>
 		struct parameter_list_t
 		{
@@ -55,6 +76,19 @@ namespace sqlpp
 					_bind_impl(target, detail::make_index_sequence<size::value>{});
 				}
 
+			// Binds all parameters if the target forgets bindings, only the modified ones otherwise
+			template<typename Target>
+				void _bind(Target& target, const std::false_type&) const
+				{
+					_bind(target);
+				}
+
+			template<typename Target>
+				void _bind(Target& target, const std::true_type&) const
+				{
+					_bind_modified_impl(target, detail::make_index_sequence<size::value>{});
+				}
+
 		private:
 			template<typename Target, size_t... Is>
 				void _bind_impl(Target& target, const detail::index_sequence<Is...>&) const
@@ -62,6 +96,20 @@ namespace sqlpp
 					using swallow = int[];  // see interpret_tuple.h
 					(void) swallow{(static_cast<typename std::tuple_element<Is, const _member_tuple_t>::type&>(*this)()._bind(target, Is), 0)...};
 				}
+
+			template<typename Target, size_t... Is>
+				void _bind_modified_impl(Target& target, const detail::index_sequence<Is...>&) const
+				{
+					using swallow = int[];
+					(void) swallow{(_bind_if_modified(static_cast<typename std::tuple_element<Is, const _member_tuple_t>::type&>(*this)(), target, Is), 0)...};
+				}
+
+			template<typename ParameterValue, typename Target>
+				static void _bind_if_modified(const ParameterValue& value, Target& target, size_t index)
+				{
+					if (value._is_modified())
+						value._bind(target, index);
+				}
 		};
 
 	template<typename Exp>
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_PIPELINE_H
+#define SQLPP_PIPELINE_H
+
+#include <tuple>
+#include <utility>
+
+namespace sqlpp
+{
+	template<typename Db, typename... Statements>
+		using pipeline_result_t = std::tuple<decltype(std::declval<Db&>()(std::declval<const Statements&>()))...>;
+
+	// Executes the statements one after the other, waiting for each reply
+	template<typename Db, typename... Statements>
+		pipeline_result_t<Db, Statements...> run_pipeline_sequentially(Db& db, const Statements&... statements)
+		{
+			// Braced initialization guarantees left to right evaluation
+			return pipeline_result_t<Db, Statements...>{db(statements)...};
+		}
+
+	namespace detail
+	{
+		// Connectors with pipelining send all statements before reading the first reply
+		template<typename Db, typename... Statements>
+			auto run_pipeline_impl(Db& db, int, const Statements&... statements)
+			-> decltype(db._run_pipeline(statements...))
+			{
+				return db._run_pipeline(statements...);
+			}
+
+		template<typename Db, typename... Statements>
+			pipeline_result_t<Db, Statements...> run_pipeline_impl(Db& db, long, const Statements&... statements)
+			{
+				return run_pipeline_sequentially(db, statements...);
+			}
+	}
+
+	// Executes independent statements and prepared statements in order and returns their results
+	// as a tuple, e.g. result_t for selects and the number of affected rows for inserts.
+	// Connectors that support pipelining (_run_pipeline) need one round trip for all of them,
+	// all others execute them sequentially.
+	template<typename Db, typename... Statements>
+		pipeline_result_t<Db, Statements...> run_pipeline(Db& db, const Statements&... statements)
+		{
+			return detail::run_pipeline_impl(db, 0, statements...);
+		}
+}
+
+#endif
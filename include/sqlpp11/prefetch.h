@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_PREFETCH_H
+#define SQLPP_PREFETCH_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/result.h>
+
+namespace sqlpp
+{
+	namespace detail
+	{
+		// Ring of column batches, filled by the fetching thread and handed out to the consumer in order
+		template<typename Result, typename ColumnBatch>
+			struct prefetch_buffer_t
+			{
+				prefetch_buffer_t(Result&& result, std::size_t depth, std::size_t batch_size):
+					_result(std::move(result))
+				{
+					// A batch without rows would never reach the end of the result
+					if (batch_size == 0)
+						throw exception("prefetch() requires a batch size greater than zero");
+
+					// One more slot than depth for the batch the consumer is processing
+					_slots.reserve(depth + 1);
+					for (std::size_t i = 0; i <= depth; ++i)
+					{
+						_slots.emplace_back(batch_size);
+					}
+				}
+
+				// Runs on the fetching thread
+				void _fetch()
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					while (true)
+					{
+						_released.wait(lock, [this](){ return _stopped or _produced - _consumed < _slots.size(); });
+						if (_stopped)
+							return;
+
+						// The slot is invisible to the consumer until _produced is incremented
+						auto& batch = _slots[_produced % _slots.size()];
+						lock.unlock();
+						std::size_t rows = 0;
+						try
+						{
+							rows = _result.fetch_columns(batch);
+						}
+						catch (...)
+						{
+							lock.lock();
+							_error = std::current_exception();
+							_done = true;
+							_filled.notify_one();
+							return;
+						}
+						lock.lock();
+
+						if (rows == 0)
+						{
+							_done = true;
+							_filled.notify_one();
+							return;
+						}
+						++_produced;
+						_filled.notify_one();
+					}
+				}
+
+				const ColumnBatch* _next_batch()
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					if (_holding)
+					{
+						_holding = false;
+						++_consumed;
+						_released.notify_one();
+					}
+					_filled.wait(lock, [this](){ return _done or _produced > _consumed; });
+					if (_produced > _consumed)
+					{
+						_holding = true;
+						return &_slots[_consumed % _slots.size()];
+					}
+					if (_error)
+					{
+						std::rethrow_exception(std::move(_error));
+					}
+					return nullptr;
+				}
+
+				void _stop()
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_stopped = true;
+					_released.notify_one();
+				}
+
+				Result _result;
+				std::vector<ColumnBatch> _slots;
+				std::mutex _mutex;
+				std::condition_variable _filled;
+				std::condition_variable _released;
+				std::size_t _produced = 0;
+				std::size_t _consumed = 0;
+				bool _holding = false;
+				bool _done = false;
+				bool _stopped = false;
+				std::exception_ptr _error;
+			};
+	}
+
+	// Fetches column batches of a result on a helper thread while the caller processes the current one.
+	// The result is used exclusively by that thread, the connection must allow fetching results
+	// from another thread while it is being used for other statements.
+	template<typename DbResult, typename ResultRow>
+		class prefetched_result_t
+		{
+			using _result_t = result_t<DbResult, ResultRow>;
+			using _batch_t = column_batch_t<ResultRow>;
+			using _buffer_t = detail::prefetch_buffer_t<_result_t, _batch_t>;
+
+			std::unique_ptr<_buffer_t> _buffer;
+			std::thread _thread;
+
+			void _join()
+			{
+				if (_thread.joinable())
+				{
+					_buffer->_stop();
+					_thread.join();
+				}
+			}
+
+		public:
+			prefetched_result_t(_result_t&& result, std::size_t depth, std::size_t batch_size):
+				_buffer(new _buffer_t(std::move(result), depth, batch_size)),
+				_thread(&_buffer_t::_fetch, _buffer.get())
+			{}
+
+			prefetched_result_t(const prefetched_result_t&) = delete;
+			prefetched_result_t(prefetched_result_t&&) = default;
+			prefetched_result_t& operator=(const prefetched_result_t&) = delete;
+			prefetched_result_t& operator=(prefetched_result_t&& rhs)
+			{
+				_join();
+				_buffer = std::move(rhs._buffer);
+				_thread = std::move(rhs._thread);
+				return *this;
+			}
+
+			~prefetched_result_t()
+			{
+				_join();
+			}
+
+			// The next batch of rows or nullptr at the end of the result.
+			// The batch stays valid until the next call, errors of the fetching thread are rethrown here.
+			const _batch_t* next_batch()
+			{
+				return _buffer->_next_batch();
+			}
+		};
+
+	// Up to depth batches of batch_size rows are fetched ahead of the one being processed
+	template<typename DbResult, typename ResultRow>
+		prefetched_result_t<DbResult, ResultRow> prefetch(result_t<DbResult, ResultRow>&& result, std::size_t depth = 2, std::size_t batch_size = 1024)
+		{
+			return prefetched_result_t<DbResult, ResultRow>(std::move(result), depth, batch_size);
+		}
+}
+
+#endif
@@ -54,7 +54,7 @@ namespace sqlpp
 
 			void _bind_params() const
 			{
-				params._bind(_prepared_statement);
+				params._bind(_prepared_statement, keeps_parameter_bindings_t<Database>{});
 			}
 
 			_parameter_list_t params;
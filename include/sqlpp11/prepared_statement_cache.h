@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_PREPARED_STATEMENT_CACHE_H
+#define SQLPP_PREPARED_STATEMENT_CACHE_H
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <sqlpp11/serialize.h>
+
+namespace sqlpp
+{
+	// Prepared statement handles of a connection, keyed by their SQL.
+	// Connectors use it to prepare directly executed statements on first use and to reuse the handle later on.
+	// The least recently used handle is dropped when the cache is full. A capacity of 0 disables the cache,
+	// connectors check enabled() before calling get(). If they call it anyway, the statement is prepared on
+	// every call and the handle is valid until the next call only.
+	//
+	// Literal values are part of the prepared SQL. Statements which differ in literal values only get an
+	// entry each, so a statement with values that change from call to call is prepared on every call and
+	// pushes the other entries out of the cache. Use parameters for such values.
+	template<typename PreparedStatement>
+		class prepared_statement_cache_t
+		{
+			struct _entry_t
+			{
+				std::string _sql;
+				PreparedStatement _prepared_statement;
+			};
+
+			using _entries_t = std::list<_entry_t>;
+
+		public:
+			prepared_statement_cache_t() = default;
+
+			explicit prepared_statement_cache_t(std::size_t capacity):
+				_capacity(capacity)
+			{}
+
+			prepared_statement_cache_t(const prepared_statement_cache_t&) = delete;
+			prepared_statement_cache_t(prepared_statement_cache_t&&) = default;
+			prepared_statement_cache_t& operator=(const prepared_statement_cache_t&) = delete;
+			prepared_statement_cache_t& operator=(prepared_statement_cache_t&&) = default;
+			~prepared_statement_cache_t() = default;
+
+			// Returns the handle for the SQL, calls prepare() to obtain it if it is not cached
+			template<typename Prepare>
+				PreparedStatement& get(const std::string& sql, Prepare prepare)
+				{
+					if (_capacity == 0)
+					{
+						++_misses;
+						_uncached.clear();
+						_uncached.push_front(_entry_t{sql, prepare()});
+						return _uncached.front()._prepared_statement;
+					}
+
+					const auto it = _index.find(sql);
+					if (it != _index.end())
+					{
+						++_hits;
+						_entries.splice(_entries.begin(), _entries, it->second);
+						return it->second->_prepared_statement;
+					}
+
+					++_misses;
+					if (_entries.size() >= _capacity and not _entries.empty())
+					{
+						_index.erase(_entries.back()._sql);
+						_entries.pop_back();
+					}
+					_entries.push_front(_entry_t{sql, prepare()});
+					_index[sql] = _entries.begin();
+					return _entries.front()._prepared_statement;
+				}
+
+			bool enabled() const
+			{
+				return _capacity > 0;
+			}
+
+			std::size_t capacity() const
+			{
+				return _capacity;
+			}
+
+			void set_capacity(std::size_t capacity)
+			{
+				_capacity = capacity;
+				while (_entries.size() > _capacity)
+				{
+					_index.erase(_entries.back()._sql);
+					_entries.pop_back();
+				}
+			}
+
+			std::size_t size() const
+			{
+				return _entries.size();
+			}
+
+			std::size_t hits() const
+			{
+				return _hits;
+			}
+
+			std::size_t misses() const
+			{
+				return _misses;
+			}
+
+			void clear()
+			{
+				_index.clear();
+				_entries.clear();
+				_uncached.clear();
+			}
+
+		private:
+			std::size_t _capacity = 0;
+			std::size_t _hits = 0;
+			std::size_t _misses = 0;
+			_entries_t _entries;
+			_entries_t _uncached; // the last handle returned while the cache is disabled
+			std::unordered_map<std::string, typename _entries_t::iterator> _index;
+		};
+
+	// Serializes the statement into the context and returns the cached handle for it.
+	// prepare() is called on a miss and has to return a new handle for context.str().
+	template<typename PreparedStatement, typename Statement, typename Context, typename Prepare>
+		PreparedStatement& prepare_cached(prepared_statement_cache_t<PreparedStatement>& cache, const Statement& statement, Context& context, Prepare prepare)
+		{
+			serialize(statement, context);
+			return cache.get(context.str(), prepare);
+		}
+}
+
+#endif
@@ -52,7 +52,7 @@ namespace sqlpp
 
 			void _bind_params() const
 			{
-				params._bind(_prepared_statement);
+				params._bind(_prepared_statement, keeps_parameter_bindings_t<Db>{});
 			}
 
 			_parameter_list_t params;
@@ -27,6 +27,10 @@
 #ifndef SQLPP_RESULT_H
 #define SQLPP_RESULT_H
 
+#include <vector>
+#include <sqlpp11/column_batch.h>
+#include <sqlpp11/exception.h>
+
 // FIXME: include for move?
 namespace sqlpp
 {
@@ -121,6 +125,38 @@ namespace sqlpp
 				_result.next(_result_row);
 			}
 
+			// Moves the current row into a Struct with one member per selected column, in select order
+			template<typename Struct>
+				Struct into()
+				{
+					if (not _result_row)
+						throw exception("into() called on an empty result");
+					auto row = _result_row.template _into<Struct>();
+					_result.next(_result_row);
+					return row;
+				}
+
+			// Moves all remaining rows into a vector, see into()
+			template<typename Struct>
+				std::vector<Struct> as_vector()
+				{
+					std::vector<Struct> rows;
+					while (_result_row)
+					{
+						rows.push_back(_result_row.template _into<Struct>());
+						_result.next(_result_row);
+					}
+					return rows;
+				}
+
+			// Fills the batch with up to batch.capacity() rows, returns the number of rows.
+			// The columns are overwritten by the next call, see column_batch.h
+			template<typename ColumnBatch>
+				std::size_t fetch_columns(ColumnBatch& batch)
+				{
+					return detail::fetch_columns(_result, _result_row, batch);
+				}
+
 		};
 }
 
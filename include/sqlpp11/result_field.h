@@ -27,11 +27,79 @@
 #ifndef SQLPP_RESULT_FIELD_H
 #define SQLPP_RESULT_FIELD_H
 
+#include <cstddef>
+#include <cstdint>
 #include <sqlpp11/wrong.h>
+#include <sqlpp11/null_bitmap.h>
 #include <sqlpp11/result_field_methods.h>
 
 namespace sqlpp
 {
+	namespace detail
+	{
+		// The NULL indicators of a result row, handed to its fields, see result_row.h.
+		// Connectors with _bind_null_bitmap() fill the bitmap, one bit per field index. All others write
+		// an indicator per field, it stays valid for the life of the row, so they may keep the pointer.
+		struct result_null_binding_t
+		{
+			null_bitmap_ref_t _bits;
+			bool* _indicators; // nullptr while the bitmap is used
+
+			bool* _indicator(std::size_t index) const
+			{
+				return _indicators ? _indicators + index : nullptr;
+			}
+		};
+
+		// NULL indicator of a result field: its bit in the null bitmap of the row or its indicator in the row.
+		// The row attaches it when it is constructed, moved or bound. Fields of columns that cannot be NULL
+		// carry none at all.
+		template<bool CanBeNull>
+			struct result_null_indicator_t
+			{
+				const void* _null_source = nullptr;
+				std::uint8_t _null_mask = 0; // 0 for an indicator of the field
+
+				bool _null() const
+				{
+					if (_null_source == nullptr)
+						return true;
+					if (_null_mask == 0)
+						return *static_cast<const bool*>(_null_source);
+					return *static_cast<const std::uint8_t*>(_null_source) & _null_mask;
+				}
+
+				void _attach_nulls(const result_null_binding_t& nulls, std::size_t index)
+				{
+					if (nulls._indicators)
+					{
+						_null_source = nulls._indicators + index;
+						_null_mask = 0;
+					}
+					else
+					{
+						_null_source = nulls._bits.data() + index / 8;
+						_null_mask = static_cast<std::uint8_t>(1u << (index % 8));
+					}
+				}
+			};
+
+		template<>
+			struct result_null_indicator_t<false>
+			{
+				bool _null() const
+				{
+					return false;
+				}
+
+				void _attach_nulls(const result_null_binding_t&, std::size_t)
+				{}
+			};
+
+		template<typename FieldSpec>
+			using result_null_indicator_of = result_null_indicator_t<column_spec_can_be_null_t<FieldSpec>::value>;
+	}
+
 	template<typename ValueType, typename Db, typename FieldSpec>
 		struct result_field_t
 		{
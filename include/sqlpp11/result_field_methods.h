@@ -82,6 +82,7 @@ namespace sqlpp
 						tag_if<tag::null_is_trivial_value, _base_t::_null_is_trivial>>;
 
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 			using _can_be_null = column_spec_can_be_null_t<_field_spec_t>;
 		};
 
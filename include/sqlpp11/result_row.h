@@ -27,9 +27,19 @@
 #ifndef SQLPP_RESULT_ROW_H
 #define SQLPP_RESULT_ROW_H
 
-#include <map>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <sqlpp11/result_row_fwd.h>
 #include <sqlpp11/field_spec.h>
+#include <sqlpp11/null_bitmap.h>
+#include <sqlpp11/result_field.h>
 #include <sqlpp11/text.h>
 #include <sqlpp11/detail/field_index_sequence.h>
 
@@ -37,6 +47,75 @@ namespace sqlpp
 {
 	namespace detail
 	{
+		// Fields with a NULL indicator refer to the NULL indicators of the row, see result_field.h
+		template<typename Field>
+			auto attach_nulls(Field& field, const result_null_binding_t& nulls, std::size_t index, int)
+			-> decltype(field._attach_nulls(nulls, index))
+			{
+				field._attach_nulls(nulls, index);
+			}
+
+		template<typename Field>
+			void attach_nulls(Field&, const result_null_binding_t&, std::size_t, long)
+			{}
+
+		// Text and blob fields report NULL via the value the connector binds
+		template<typename Field, typename Target>
+			auto bind_result_field(Field& field, Target& target, std::size_t index, const result_null_binding_t& nulls, int)
+			-> decltype(field._bind(target, index, nulls))
+			{
+				field._bind(target, index, nulls);
+			}
+
+		template<typename Field, typename Target>
+			void bind_result_field(Field& field, Target& target, std::size_t index, const result_null_binding_t&, long)
+			{
+				field._bind(target, index);
+			}
+
+		// Connectors with _bind_null_bitmap() fill the bitmap of the row in bulk and get no indicators per field
+		template<typename Target>
+			auto bind_null_bitmap(Target& target, null_bitmap_ref_t bits, std::size_t count, int)
+			-> decltype(target._bind_null_bitmap(bits, count), bool())
+			{
+				target._bind_null_bitmap(bits, count);
+				return true;
+			}
+
+		template<typename Target>
+			bool bind_null_bitmap(Target&, null_bitmap_ref_t, std::size_t, long)
+			{
+				return false;
+			}
+
+		// NULL indicators of the fields of a result row, by field index: a packed bitmap for connectors that
+		// fill it in bulk, one indicator per field for all others. NULL until bound.
+		template<std::size_t FieldCount>
+			struct result_row_nulls_t
+			{
+				std::uint8_t _bits[FieldCount ? null_bitmap_ref_t::bytes(FieldCount) : 1];
+				bool _indicators[FieldCount ? FieldCount : 1];
+				bool _uses_indicators = false;
+
+				result_row_nulls_t()
+				{
+					std::memset(_bits, 0xff, sizeof(_bits));
+					std::fill(std::begin(_indicators), std::end(_indicators), true);
+				}
+
+				result_null_binding_t _binding()
+				{
+					return {null_bitmap_ref_t(_bits), _uses_indicators ? _indicators : nullptr};
+				}
+
+				template<typename Target>
+					result_null_binding_t _bind(Target& target)
+					{
+						_uses_indicators = not bind_null_bitmap(target, null_bitmap_ref_t(_bits), FieldCount, 0);
+						return _binding();
+					}
+			};
+
 		template<typename Db, typename IndexSequence, typename... FieldSpecs>
 			struct result_row_impl;
 
@@ -48,21 +127,16 @@ namespace sqlpp
 
 			result_field() = default;
 
-			void _validate()
-			{
-				_field::operator()()._validate();
-			}
-
-			void _invalidate()
-			{
-				_field::operator()()._invalidate();
-			}
-
 			template<typename Target>
-				void _bind(Target& target)
+				void _bind(Target& target, const result_null_binding_t& nulls)
 				{
-					_field::operator()()._bind(target, index);
+					bind_result_field(_field::operator()(), target, index, nulls, 0);
 				}
+
+			void _attach_nulls(const result_null_binding_t& nulls)
+			{
+				attach_nulls(_field::operator()(), nulls, index, 0);
+			}
 		};
 
 		template<std::size_t index, AliasProvider Alias, typename Db, typename... FieldSpecs>
@@ -73,21 +147,16 @@ namespace sqlpp
 
 				result_field() = default;
 
-				void _validate()
-				{
-					_multi_field::operator()()._validate();
-				}
-
-				void _invalidate()
-				{
-					_multi_field::operator()()._invalidate();
-				}
-
 				template<typename Target>
-					void _bind(Target& target)
+					void _bind(Target& target, const result_null_binding_t& nulls)
 					{
-						_multi_field::operator()()._bind(target);
+						_multi_field::operator()()._bind(target, nulls);
 					}
+
+				void _attach_nulls(const result_null_binding_t& nulls)
+				{
+					_multi_field::operator()()._attach_nulls(nulls);
+				}
 			};
 
 		template<typename Db, std::size_t NextIndex, std::size_t... Is, typename... FieldSpecs>
@@ -96,24 +165,18 @@ namespace sqlpp
 			{
 				result_row_impl() = default;
 
-				void _validate()
-				{
-					using swallow = int[];
-					(void) swallow{(result_field<Db, Is, FieldSpecs>::_validate(), 0)...};
-				}
-
-				void _invalidate()
-				{
-					using swallow = int[];
-					(void) swallow{(result_field<Db, Is, FieldSpecs>::_invalidate(), 0)...};
-				}
-
 				template<typename Target>
-					void _bind(Target& target)
+					void _bind(Target& target, const result_null_binding_t& nulls)
 					{
 						using swallow = int[];
-						(void) swallow{(result_field<Db, Is, FieldSpecs>::_bind(target), 0)...};
+						(void) swallow{(result_field<Db, Is, FieldSpecs>::_bind(target, nulls), 0)...};
 					}
+
+				void _attach_nulls(const result_null_binding_t& nulls)
+				{
+					using swallow = int[];
+					(void) swallow{(result_field<Db, Is, FieldSpecs>::_attach_nulls(nulls), 0)...};
+				}
 			};
 
 	}
@@ -124,11 +187,13 @@ namespace sqlpp
 		using _field_index_sequence = detail::make_field_index_sequence<0, FieldSpecs...>;
 		using _impl = detail::result_row_impl<Db, _field_index_sequence, FieldSpecs...>;
 		bool _is_valid;
+		detail::result_row_nulls_t<_field_index_sequence::_next_index> _nulls;
 
 		result_row_t():
 			_impl(),
 			_is_valid(false)
 		{
+			_impl::_attach_nulls(_nulls._binding());
 		}
 
 		template<typename DynamicNames>
@@ -136,22 +201,38 @@ namespace sqlpp
 				_impl(),
 				_is_valid(false)
 		{
+			_impl::_attach_nulls(_nulls._binding());
 		}
 
 		result_row_t(const result_row_t&) = delete;
-		result_row_t(result_row_t&&) = default;
+		result_row_t(result_row_t&& rhs):
+			_impl(std::move(rhs)),
+			_is_valid(rhs._is_valid),
+			_nulls(rhs._nulls)
+		{
+			// the moved fields still refer to the NULL indicators of rhs
+			_impl::_attach_nulls(_nulls._binding());
+		}
 		result_row_t& operator=(const result_row_t&) = delete;
-		result_row_t& operator=(result_row_t&&) = default;
+		result_row_t& operator=(result_row_t&& rhs)
+		{
+			_impl::operator=(std::move(rhs));
+			_is_valid = rhs._is_valid;
+			_nulls = rhs._nulls;
+			_impl::_attach_nulls(_nulls._binding());
+			return *this;
+		}
+		~result_row_t() = default;
 
+		// Validity is tracked for the row as a whole, the fields must not be accessed
+		// while the row is invalid, e.g. after the last row of a result
 		void _validate()
 		{
-			_impl::_validate();
 			_is_valid = true;
 		}
 
 		void _invalidate()
 		{
-			_impl::_invalidate();
 			_is_valid = false;
 		}
 
@@ -170,13 +251,27 @@ namespace sqlpp
 			return _field_index_sequence::_next_index;
 		}
 
+		// Aggregate initialization of Struct with the values of the selected columns, in select order.
+		// The caller checks the validity of the row, see result_t::as_vector().
+		template<typename Struct>
+			Struct _into() const
+			{
+				return Struct{static_cast<const typename FieldSpecs::_alias_t::template _member_t<result_field_t<value_type_of<FieldSpecs>, Db, FieldSpecs>>&>(*this)().value()...};
+			}
+
 		template<typename Target>
 			void _bind(Target& target)
 			{
-				_impl::_bind(target);
+				_impl::_bind(target, _nulls._bind(target));
 			}
 	};
 
+	// Position of a dynamic field, resolved once via dynamic_result_row_t::handle()
+	struct dynamic_field_handle_t
+	{
+		std::size_t _index;
+	};
+
 	template<typename Db, typename... FieldSpecs>
 		struct dynamic_result_row_t: public detail::result_row_impl<Db, detail::make_field_index_sequence<0, FieldSpecs...>, FieldSpecs...>
 	{
@@ -192,50 +287,62 @@ namespace sqlpp
 		using _field_type = result_field_t<text, Db, _field_spec_t>;
 
 		bool _is_valid;
-		std::vector<std::string> _dynamic_field_names;
-		std::map<std::string, _field_type> _dynamic_fields;
+		detail::result_row_nulls_t<_field_index_sequence::_next_index> _nulls;
+		std::vector<_field_type> _dynamic_fields; // in select order
+		std::unordered_map<std::string, std::size_t> _dynamic_field_index;
 
 		dynamic_result_row_t(): 
 			_impl(),
 			_is_valid(false)
 		{
+			_impl::_attach_nulls(_nulls._binding());
 		}
 
-		dynamic_result_row_t(const std::vector<std::string>& dynamic_field_names): 
+		template<typename DynamicNames>
+		dynamic_result_row_t(const DynamicNames& dynamic_field_names): 
 			_impl(),
-			_is_valid(false),
-			_dynamic_field_names(dynamic_field_names)
+			_is_valid(false)
 		{
-			for (auto field_name : _dynamic_field_names)
+			_impl::_attach_nulls(_nulls._binding());
+			for (const auto& field_name : dynamic_field_names)
 			{
-				_dynamic_fields.insert({field_name, _field_type{}});
+				_dynamic_field_index.insert({field_name, _dynamic_fields.size()});
+				_dynamic_fields.emplace_back();
 			}
 		}
 
 		dynamic_result_row_t(const dynamic_result_row_t&) = delete;
-		dynamic_result_row_t(dynamic_result_row_t&&) = default;
+		dynamic_result_row_t(dynamic_result_row_t&& rhs):
+			_impl(std::move(rhs)),
+			_is_valid(rhs._is_valid),
+			_nulls(rhs._nulls),
+			_dynamic_fields(std::move(rhs._dynamic_fields)),
+			_dynamic_field_index(std::move(rhs._dynamic_field_index))
+		{
+			// the moved fields still refer to the NULL indicators of rhs
+			_impl::_attach_nulls(_nulls._binding());
+		}
 		dynamic_result_row_t& operator=(const dynamic_result_row_t&) = delete;
-		dynamic_result_row_t& operator=(dynamic_result_row_t&&) = default;
+		dynamic_result_row_t& operator=(dynamic_result_row_t&& rhs)
+		{
+			_impl::operator=(std::move(rhs));
+			_is_valid = rhs._is_valid;
+			_nulls = rhs._nulls;
+			_dynamic_fields = std::move(rhs._dynamic_fields);
+			_dynamic_field_index = std::move(rhs._dynamic_field_index);
+			_impl::_attach_nulls(_nulls._binding());
+			return *this;
+		}
+		~dynamic_result_row_t() = default;
 
 		void _validate()
 		{
-
-			_impl::_validate();
 			_is_valid = true;
-			for (auto& field : _dynamic_fields)
-			{
-				field.second._validate();
-			}
 		}
 
 		void _invalidate()
 		{
-			_impl::_invalidate();
 			_is_valid = false;
-			for (auto& field : _dynamic_fields)
-			{
-				field.second._invalidate();
-			}
 		}
 
 		bool operator==(const dynamic_result_row_t& rhs) const
@@ -245,7 +352,18 @@ namespace sqlpp
 
 		const _field_type& at(const std::string& field_name) const
 		{
-			return _dynamic_fields.at(field_name);
+			return _dynamic_fields.at(_dynamic_field_index.at(field_name));
+		}
+
+		// Resolves the name once, the handle is valid for all rows of the result
+		dynamic_field_handle_t handle(const std::string& field_name) const
+		{
+			return {_dynamic_field_index.at(field_name)};
+		}
+
+		const _field_type& at(const dynamic_field_handle_t& handle) const
+		{
+			return _dynamic_fields[handle._index];
 		}
 
 		explicit operator bool() const
@@ -256,12 +374,12 @@ namespace sqlpp
 		template<typename Target>
 			void _bind(Target& target)
 			{
-				_impl::_bind(target);
+				_impl::_bind(target, _nulls._bind(target));
 
 				std::size_t index = _field_index_sequence::_next_index;
-				for (const auto& field_name : _dynamic_field_names)
+				for (auto& field : _dynamic_fields)
 				{
-					_dynamic_fields.at(field_name)._bind(target, index);
+					field._bind(target, index);
 					++index;
 				}
 			}
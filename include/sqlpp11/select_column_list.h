@@ -35,7 +35,9 @@
 #include <sqlpp11/expression_fwd.h>
 #include <sqlpp11/select_pseudo_table.h>
 #include <sqlpp11/named_interpretable.h>
+#include <sqlpp11/arena.h>
 #include <sqlpp11/interpret_tuple.h>
+#include <sqlpp11/static_sql.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/detail/type_set.h>
 #include <sqlpp11/detail/copy_tuple_args.h>
@@ -62,13 +64,18 @@ namespace sqlpp
 	template<typename Db>
 		struct dynamic_select_column_list
 		{
-			using _names_t = std::vector<std::string>;
-			std::vector<named_interpretable_t<Db>> _dynamic_columns;
+			using _names_t = std::vector<std::string, arena_allocator<std::string>>;
+			std::vector<named_interpretable_t<Db>, arena_allocator<named_interpretable_t<Db>>> _dynamic_columns;
 			_names_t _dynamic_expression_names;
 
 			template<typename Expr>
 				void emplace_back(Expr expr)
 				{
+					if (_dynamic_columns.empty())
+					{
+						_dynamic_expression_names.reserve(4);
+						_dynamic_columns.reserve(4);
+					}
 					_dynamic_expression_names.push_back(name_of<Expr>::char_ptr());
 					_dynamic_columns.emplace_back(expr);
 				}
@@ -77,6 +84,12 @@ namespace sqlpp
 			{
 				return _dynamic_columns.empty();
 			}
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::move_to_arena(_dynamic_expression_names, arena);
+				detail::move_to_arena(_dynamic_columns, arena);
+			}
 		};
 
 	template<>
@@ -102,7 +115,7 @@ namespace sqlpp
 			static Context& _(const T& t, Context& context)
 			{
 				bool first = true;
-				for (const auto column : t._dynamic_columns)
+				for (const auto& column : t._dynamic_columns)
 				{
 					if (first)
 						first = false;
@@ -145,6 +158,11 @@ namespace sqlpp
 
 			std::tuple<Columns...> _columns;
 			dynamic_select_column_list<Database> _dynamic_columns;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_columns, arena);
+			}
 		};
 
 	struct assert_no_unknown_tables_in_selected_columns_t
@@ -451,12 +469,31 @@ namespace sqlpp
 
 			static Context& _(const T& t, Context& context)
 			{
-				interpret_tuple(t._columns, ',', context);
+				_serialize_columns(t._columns, context, _is_cached{});
 				if (sizeof...(Columns) and not t._dynamic_columns.empty())
 					context << ',';
 				serialize(t._dynamic_columns, context);
 				return context;
 			}
+
+			// The dynamic part of a dynamic select carries runtime data, the static columns are cached on their own
+			using _is_cached = std::integral_constant<bool, cache_static_sql_t<Context>::value
+				and not logic::any_t<has_runtime_data_t<Columns>::value...>::value>;
+
+			static void _render_columns(const std::tuple<Columns...>& columns, Context& context)
+			{
+				interpret_tuple(columns, ',', context);
+			}
+
+			static void _serialize_columns(const std::tuple<Columns...>& columns, Context& context, const std::false_type&)
+			{
+				_render_columns(columns, context);
+			}
+
+			static void _serialize_columns(const std::tuple<Columns...>& columns, Context& context, const std::true_type&)
+			{
+				append_static_sql(static_sql_t<Context, T>::get(columns, &_render_columns), context);
+			}
 		};
 
 	template<typename... T>
@@ -53,6 +53,11 @@ namespace sqlpp
 
 			std::tuple<Flags...> _flags;
 			interpretable_list_t<Database> _dynamic_flags;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_flags, arena);
+			}
 		};
 
 	// SELECT FLAGS
@@ -59,6 +59,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<no_value_t, tag::is_table, tag::is_pseudo_table>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = has_runtime_data_t<Select>;
 
 		select_pseudo_table_t(Select select):
 			_select(select)
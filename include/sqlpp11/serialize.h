@@ -27,7 +27,15 @@
 #ifndef SQLPP_SERIALIZE_H
 #define SQLPP_SERIALIZE_H
 
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <sqlpp11/serializer.h>
+#include <sqlpp11/serializer_context.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/detail/number_format.h>
 #include <sqlpp11/concepts.h>
 
 namespace sqlpp
@@ -39,6 +47,145 @@ namespace sqlpp
 			return serializer_t<Context, T>::_(t, context);
 		}
 
+	namespace detail
+	{
+		template<typename MemberFunction>
+			struct member_function_class
+			{
+				using type = void;
+			};
+
+		template<typename R, typename Class, typename... Args>
+			struct member_function_class<R (Class::*)(Args...)>
+			{
+				using type = Class;
+			};
+
+		// The class that declares Context::append_escaped(), void if there is none (or several)
+		template<typename Context, typename Enable = void>
+			struct append_escaped_class
+			{
+				using type = void;
+			};
+
+		template<typename Context>
+			struct append_escaped_class<Context, decltype(void(&Context::append_escaped))>
+			{
+				using type = typename member_function_class<decltype(&Context::append_escaped)>::type;
+			};
+
+		template<typename Context, typename Base, typename Enable = void>
+			struct inherits_escape: std::false_type {};
+
+		template<typename Context, typename Base>
+			struct inherits_escape<Context, Base, typename std::enable_if<std::is_same<decltype(&Context::escape), decltype(&Base::escape)>::value>::type>:
+				std::integral_constant<bool, &Context::escape == &Base::escape> {};
+
+		// append_escaped() must escape like escape(): an inherited append_escaped() is only used
+		// if escape() is inherited from the same class, too
+		template<typename Context, typename Base = typename append_escaped_class<Context>::type>
+			struct escapes_in_place: std::integral_constant<bool, std::is_same<Context, Base>::value or inherits_escape<Context, Base>::value> {};
+
+		template<typename Context>
+			struct escapes_in_place<Context, void>: std::false_type {};
+
+		template<typename Context, bool = escapes_in_place<Context>::value>
+			struct serialize_escaped_impl
+			{
+				static void _(const char* s, std::size_t len, Context& context)
+				{
+					context << context.escape(std::string(s, len));
+				}
+			};
+
+		template<typename Context>
+			struct serialize_escaped_impl<Context, true>
+			{
+				static void _(const char* s, std::size_t len, Context& context)
+				{
+					context.append_escaped(s, len);
+				}
+			};
+	}
+
+	// Contexts can provide append_escaped(const char*, size_t) to write escaped text without temporary strings,
+	// otherwise the result of escape(std::string) is written. Contexts that override escape() and inherit
+	// append_escaped() get their escape().
+	template<typename Context>
+		Context& serialize_escaped(const char* s, std::size_t len, Context& context)
+		{
+			detail::serialize_escaped_impl<Context>::_(s, len, context);
+			return context;
+		}
+
+	namespace detail
+	{
+		template<typename Context, bool = std::is_base_of<serializer_context_t, Context>::value>
+			struct append_number_impl
+			{
+				static void _(char* first, char* last, Context& context)
+				{
+					*last = '\0';
+					context << static_cast<const char*>(first);
+				}
+			};
+
+		template<typename Context>
+			struct append_number_impl<Context, true>
+			{
+				static void _(char* first, char* last, Context& context)
+				{
+					context._buffer.append(first, static_cast<std::size_t>(last - first));
+				}
+			};
+	}
+
+	// Numbers are formatted independently of the global locale, doubles with round-trip precision
+	template<typename Context>
+		Context& serialize_integral(std::int64_t value, Context& context)
+		{
+			char s[detail::max_number_chars + 1];
+			detail::append_number_impl<Context>::_(s, detail::format_integral(s, value), context);
+			return context;
+		}
+
+	template<typename Context>
+		Context& serialize_floating_point(double value, Context& context)
+		{
+			// SQL has no literals for these
+			if (not std::isfinite(value))
+				throw exception("cannot serialize NaN or infinity");
+			char s[detail::max_number_chars + 1];
+			detail::append_number_impl<Context>::_(s, detail::format_floating_point(s, value), context);
+			return context;
+		}
+
+	// Binary data as hex literal, e.g. X'CAFE'. Long data is written in blocks to avoid temporary strings.
+	template<typename Context>
+		Context& serialize_hex(const std::uint8_t* data, std::size_t len, Context& context)
+		{
+			static constexpr const char digits[] = "0123456789ABCDEF";
+			static constexpr std::size_t block_size = 256;
+			char block[2 * block_size + 1];
+
+			context << "X'";
+			while (len)
+			{
+				const auto n = len < block_size ? len : block_size;
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					block[2 * i] = digits[data[i] >> 4];
+					block[2 * i + 1] = digits[data[i] & 0x0F];
+				}
+				block[2 * n] = '\0';
+				context << static_cast<const char*>(block);
+				data += n;
+				len -= n;
+			}
+			context << '\'';
+			return context;
+		}
+
 	template<typename T, typename Context>
 		auto serialize_operand(const T& t, Context& context)
 		-> decltype(serializer_t<Context, T>::_(t, context))
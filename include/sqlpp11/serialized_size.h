@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_SERIALIZED_SIZE_H
+#define SQLPP_SERIALIZED_SIZE_H
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <sqlpp11/serializer_context.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/interpretable.h>
+#include <sqlpp11/named_interpretable.h>
+#include <sqlpp11/detail/number_format.h>
+
+namespace sqlpp
+{
+	// Counts the characters that serializing into Context would produce, without writing them.
+	// The count is exact for contexts derived from serializer_context_t. Other contexts might
+	// write numbers or other values differently, the count is then an estimate.
+	template<typename Context>
+		struct size_counter_t
+		{
+			size_counter_t(Context& context):
+				_context(context)
+			{}
+
+			size_counter_t& operator<<(char)
+			{
+				++_size;
+				return *this;
+			}
+
+			size_counter_t& operator<<(const char* s)
+			{
+				_size += std::strlen(s);
+				return *this;
+			}
+
+			size_counter_t& operator<<(const std::string& s)
+			{
+				_size += s.size();
+				return *this;
+			}
+
+			size_counter_t& operator<<(bool)
+			{
+				++_size;
+				return *this;
+			}
+
+			template<typename T>
+				auto operator<<(T t)
+				-> typename std::enable_if<std::is_integral<T>::value and std::is_signed<T>::value, size_counter_t&>::type
+				{
+					char s[detail::max_number_chars];
+					_size += static_cast<std::size_t>(detail::format_integral(s, static_cast<std::int64_t>(t)) - s);
+					return *this;
+				}
+
+			template<typename T>
+				auto operator<<(T t)
+				-> typename std::enable_if<std::is_integral<T>::value and std::is_unsigned<T>::value, size_counter_t&>::type
+				{
+					char s[detail::max_number_chars];
+					_size += static_cast<std::size_t>(detail::format_unsigned(s, static_cast<std::uint64_t>(t)) - s);
+					return *this;
+				}
+
+			template<typename T>
+				auto operator<<(T t)
+				-> typename std::enable_if<std::is_floating_point<T>::value, size_counter_t&>::type
+				{
+					char s[detail::max_number_chars];
+					_size += static_cast<std::size_t>(detail::format_floating_point(s, static_cast<double>(t)) - s);
+					return *this;
+				}
+
+			size_counter_t& append_escaped(const char* s, std::size_t len)
+			{
+				_size += _escaped_size(s, len, std::integral_constant<bool,
+						std::is_same<typename detail::append_escaped_class<Context>::type, serializer_context_t>::value
+						and detail::escapes_in_place<Context>::value>{});
+				return *this;
+			}
+
+			std::size_t size() const
+			{
+				return _size;
+			}
+
+			Context& _context;
+			std::size_t _size = 0;
+
+		private:
+			// serializer_context_t doubles quotes
+			static std::size_t _escaped_size(const char* s, std::size_t len, const std::true_type&)
+			{
+				auto size = len;
+				const auto end = s + len;
+				while (const auto quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s))))
+				{
+					++size;
+					s = quote + 1;
+				}
+				return size;
+			}
+
+			std::size_t _escaped_size(const char* s, std::size_t len, const std::false_type&) const
+			{
+				return _context.escape(std::string(s, len)).size();
+			}
+		};
+
+	// Dynamic parts are type erased and can only be serialized into the real context
+	namespace detail
+	{
+		template<typename Context, typename Interpretable>
+			std::size_t interpretable_size(const Interpretable& t)
+			{
+				Context scratch;
+				serialize(t, scratch);
+				return scratch.str().size();
+			}
+	}
+
+	template<typename Context, typename Database>
+		struct serializer_t<size_counter_t<Context>, interpretable_t<Database>>
+		{
+			using _serialize_check = consistent_t;
+			using T = interpretable_t<Database>;
+
+			static size_counter_t<Context>& _(const T& t, size_counter_t<Context>& counter)
+			{
+				counter._size += detail::interpretable_size<Context>(t);
+				return counter;
+			}
+		};
+
+	template<typename Context, typename Database>
+		struct serializer_t<size_counter_t<Context>, named_interpretable_t<Database>>
+		{
+			using _serialize_check = consistent_t;
+			using T = named_interpretable_t<Database>;
+
+			static size_counter_t<Context>& _(const T& t, size_counter_t<Context>& counter)
+			{
+				counter._size += detail::interpretable_size<Context>(t);
+				return counter;
+			}
+		};
+
+	// The number of characters serialize(t, context) would append to the context.
+	// Use it to reserve the buffer before serializing large statements, e.g. bulk inserts.
+	// The extra pass costs more than it saves for small statements.
+	template<typename T, typename Context>
+		std::size_t serialized_size(const T& t, Context& context)
+		{
+			size_counter_t<Context> counter{context};
+			serialize(t, counter);
+			return counter.size();
+		}
+}
+
+#endif
@@ -26,42 +26,131 @@
 #ifndef SQLPP_SERIALIZER_CONTEXT_H
 #define SQLPP_SERIALIZER_CONTEXT_H
 
-#include <ostream>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <sqlpp11/static_sql.h>
+#include <sqlpp11/detail/char_buffer.h>
+#include <sqlpp11/detail/number_format.h>
 
 namespace sqlpp
 {
+	// Appends the serialized statement to a contiguous buffer.
+	// Short statements are kept inline, longer ones grow on the heap.
 	struct serializer_context_t
 	{
-		serializer_context_t(std::ostream& os):
-			_os(os)
-		{}
+		// Output depends on the serialized expression only, see static_sql.h
+		using _cache_static_sql = cache_static_sql_for<serializer_context_t>;
+
+		serializer_context_t() = default;
+		serializer_context_t(const serializer_context_t&) = default;
+		serializer_context_t(serializer_context_t&&) = default;
+		serializer_context_t& operator=(const serializer_context_t&) = default;
+		serializer_context_t& operator=(serializer_context_t&&) = default;
+		~serializer_context_t() = default;
+
+		serializer_context_t& operator<<(char c)
+		{
+			_buffer.push_back(c);
+			return *this;
+		}
+
+		serializer_context_t& operator<<(const char* s)
+		{
+			_buffer.append(s, std::strlen(s));
+			return *this;
+		}
+
+		serializer_context_t& operator<<(const std::string& s)
+		{
+			_buffer.append(s.data(), s.size());
+			return *this;
+		}
+
+		serializer_context_t& operator<<(bool b)
+		{
+			_buffer.push_back(b ? '1' : '0');
+			return *this;
+		}
+
+		template<typename T>
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_integral<T>::value and std::is_signed<T>::value, serializer_context_t&>::type
+			{
+				char s[detail::max_number_chars];
+				_buffer.append(s, static_cast<std::size_t>(detail::format_integral(s, static_cast<std::int64_t>(t)) - s));
+				return *this;
+			}
+
+		template<typename T>
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_integral<T>::value and std::is_unsigned<T>::value, serializer_context_t&>::type
+			{
+				char s[detail::max_number_chars];
+				_buffer.append(s, static_cast<std::size_t>(detail::format_unsigned(s, static_cast<std::uint64_t>(t)) - s));
+				return *this;
+			}
 
 		template<typename T>
-			std::ostream& operator<<(T t)
+			auto operator<<(T t)
+			-> typename std::enable_if<std::is_floating_point<T>::value, serializer_context_t&>::type
 			{
-				return _os << t;
+				char s[detail::max_number_chars];
+				_buffer.append(s, static_cast<std::size_t>(detail::format_floating_point(s, static_cast<double>(t)) - s));
+				return *this;
 			}
 
-		static std::string escape(std::string arg)
+		std::string str() const
 		{
-			if (arg.find('\''))
+			return _buffer.str();
+		}
+
+		void reset()
+		{
+			_buffer.clear();
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			_buffer.reserve(capacity);
+		}
+
+		std::size_t size() const
+		{
+			return _buffer.size();
+		}
+
+		const char* data() const
+		{
+			return _buffer.data();
+		}
+
+		// Appends the escaped text, clean stretches are copied in one block each
+		serializer_context_t& append_escaped(const char* s, std::size_t len)
+		{
+			const auto end = s + len;
+			while (const auto quote = static_cast<const char*>(std::memchr(s, '\'', static_cast<std::size_t>(end - s))))
 			{
-				std::string retVal;
-				for (const auto c : arg)
-				{
-					if (c == '\'')
-						retVal.push_back(c);
-					retVal.push_back(c);
-				}
-				return retVal;
+				_buffer.append(s, static_cast<std::size_t>(quote - s) + 1);
+				_buffer.push_back('\'');
+				s = quote + 1;
 			}
-			else
+			_buffer.append(s, static_cast<std::size_t>(end - s));
+			return *this;
+		}
+
+		static std::string escape(const std::string& arg)
+		{
+			if (arg.find('\'') == std::string::npos)
 				return arg;
+
+			serializer_context_t context;
+			context.append_escaped(arg.data(), arg.size());
+			return context.str();
 		}
 
-		std::ostream& _os;
+		detail::char_buffer<256> _buffer;
 	};
 }
 
 #endif
-
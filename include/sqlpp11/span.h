@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_SPAN_H
+#define SQLPP_SPAN_H
+
+#include <cstddef>
+#include <vector>
+#if __cplusplus > 201703L and defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#define SQLPP_USE_STD_SPAN
+#endif
+#endif
+
+namespace sqlpp
+{
+	// Non-owning pointer and size of a contiguous sequence, e.g. the bytes of a blob.
+	// The referenced elements must outlive the span, see the users of span for details.
+#ifdef SQLPP_USE_STD_SPAN
+	template<typename T>
+		using span = std::span<T>;
+#else
+	template<typename T>
+		class span
+		{
+		public:
+			constexpr span() = default;
+
+			constexpr span(T* data, std::size_t size):
+				_data(data),
+				_size(size)
+			{}
+
+			template<typename U, typename Allocator>
+				span(const std::vector<U, Allocator>& v):
+					_data(v.data()),
+					_size(v.size())
+			{}
+
+			constexpr T* data() const
+			{
+				return _data;
+			}
+
+			constexpr std::size_t size() const
+			{
+				return _size;
+			}
+
+			constexpr bool empty() const
+			{
+				return _size == 0;
+			}
+
+			constexpr T* begin() const
+			{
+				return _data;
+			}
+
+			constexpr T* end() const
+			{
+				return _data + _size;
+			}
+
+			constexpr T& operator[](std::size_t i) const
+			{
+				return _data[i];
+			}
+
+		private:
+			T* _data = nullptr;
+			std::size_t _size = 0;
+		};
+#endif
+}
+
+#endif
@@ -36,6 +36,13 @@
 #include <sqlpp11/functions.h>
 #include <sqlpp11/transaction.h>
 #include <sqlpp11/boolean_expression.h>
+#include <sqlpp11/serialized_size.h>
+#include <sqlpp11/fingerprint.h>
+#include <sqlpp11/batch.h>
+#include <sqlpp11/parameter_binding.h>
+#include <sqlpp11/async.h>
+#include <sqlpp11/pipeline.h>
+#include <sqlpp11/prefetch.h>
 
 #endif
 
@@ -34,6 +34,8 @@
 #include <sqlpp11/noop.h>
 #include <sqlpp11/policy_update.h>
 #include <sqlpp11/serializer.h>
+#include <sqlpp11/static_sql.h>
+#include <sqlpp11/arena.h>
 
 #include <sqlpp11/detail/get_first.h>
 #include <sqlpp11/detail/get_last.h>
@@ -147,6 +149,7 @@ namespace sqlpp
 				using _traits = make_traits<_value_type, tag_if<tag::is_expression, not std::is_same<_value_type, no_value_t>::value>>;
 
 				using _nodes = detail::type_vector<>;
+				using _has_runtime_data = logic::any_t<has_runtime_data_t<Policies>::value...>;
 				using _can_be_null = logic::any_t<
 					can_be_null_t<_result_type_provider>::value, 
 					detail::make_intersect_set_t<
@@ -209,12 +212,18 @@ namespace sqlpp
 		{}
 
 		template<typename Statement, typename Term>
-			statement_t(Statement statement, Term term):
+			statement_t(const Statement& statement, Term term):
 				Policies::template _base_t<_policies_t>{
 					typename Policies::template _impl_t<_policies_t>{
 						detail::pick_arg<typename Policies::template _base_t<_policies_t>>(statement, term)
-					}}...
-		{}
+					}}...,
+				_arena(statement._arena.get())
+		{
+			if (_arena)
+			{
+				_use_arena();
+			}
+		}
 
 		statement_t(const statement_t& r) = default;
 		statement_t(statement_t&& r) = default;
@@ -222,6 +231,17 @@ namespace sqlpp
 		statement_t& operator=(statement_t&& r) = default;
 		~statement_t() = default;
 
+		// Dynamic parts added to this statement or statements built from it allocate from the arena.
+		// The memory is released when the last of them is destroyed. Copies do not share the arena.
+		statement_t& use_arena(std::shared_ptr<arena_t> arena)
+		{
+			_arena = statement_arena_t(std::move(arena));
+			_use_arena();
+			return *this;
+		}
+
+		statement_arena_t _arena;
+
 		static constexpr size_t _get_static_no_of_parameters()
 		{
 			return detail::type_vector_size<parameters_of<statement_t>>::value;
@@ -237,6 +257,12 @@ namespace sqlpp
 			return _policies_t::_can_be_used_as_table();
 		}
 
+		void _use_arena()
+		{
+			using swallow = int[]; 
+			(void) swallow{(detail::use_arena(static_cast<typename Policies::template _base_t<_policies_t>&>(*this)()._data, _arena.get()), 0)...};
+		}
+
 		template<typename Database>
 		auto _run(Database& db) const	-> decltype(std::declval<_result_methods_t<statement_t>>()._run(db))
 		{
@@ -261,12 +287,56 @@ namespace sqlpp
 			using T = statement_t<Database, Policies...>;
 
 			static Context& _(const T& t, Context& context)
+			{
+				return _serialize(t, context, _is_cached<T>{});
+			}
+
+			// Statements and statement parts without runtime data are taken from static_sql_t.
+			// Dynamic statements thus only serialize their dynamic parts and splice them in.
+			template<typename Part>
+				using _is_cached = std::integral_constant<bool, cache_static_sql_t<Context>::value and not has_runtime_data_t<Part>::value>;
+
+			static Context& _serialize_policies(const T& t, Context& context)
 			{
 				using swallow = int[]; 
-				(void) swallow{(serialize(static_cast<const typename Policies::template _base_t<P>&>(t)()._data, context), 0)...};
+				(void) swallow{(_serialize_policy<Policies>(static_cast<const typename Policies::template _base_t<P>&>(t)()._data, context), 0)...};
 
 				return context;
 			}
+
+			static Context& _serialize(const T& t, Context& context, const std::false_type&)
+			{
+				return _serialize_policies(t, context);
+			}
+
+			static Context& _serialize(const T& t, Context& context, const std::true_type&)
+			{
+				return append_static_sql(static_sql_t<Context, T>::get(t, &_serialize_policies), context);
+			}
+
+			template<typename Policy, typename Data>
+				static void _serialize_policy(const Data& data, Context& context)
+				{
+					_serialize_policy<Policy>(data, context, _is_cached<Policy>{});
+				}
+
+			template<typename Data>
+				static void _serialize_data(const Data& data, Context& context)
+				{
+					serialize(data, context);
+				}
+
+			template<typename Policy, typename Data>
+				static void _serialize_policy(const Data& data, Context& context, const std::false_type&)
+				{
+					_serialize_data(data, context);
+				}
+
+			template<typename Policy, typename Data>
+				static void _serialize_policy(const Data& data, Context& context, const std::true_type&)
+				{
+					append_static_sql(static_sql_t<Context, Policy>::get(data, &_serialize_data<Data>), context);
+				}
 		};
 
 	template<typename NameData, typename Tag = tag::is_noop>
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_STATIC_SQL_H
+#define SQLPP_STATIC_SQL_H
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace sqlpp
+{
+	// Contexts opt into the cache by declaring
+	//   using _cache_static_sql = sqlpp::cache_static_sql_for<Context>;
+	// Derived contexts do not inherit the opt-in, they have to declare it for themselves.
+	// The cached text is rendered in a default constructed context, so
+	// contexts that keep state across calls (e.g. parameter numbering) must not opt in.
+	template<typename Context>
+		struct cache_static_sql_for
+		{
+			using _context = Context;
+		};
+
+	namespace detail
+	{
+		template<typename Context, typename Enable = void>
+			struct cache_static_sql_impl
+			{
+				using type = std::false_type;
+			};
+
+		template<typename Context>
+			struct cache_static_sql_impl<Context, typename std::enable_if<std::is_same<typename Context::_cache_static_sql::_context, Context>::value>::type>
+			{
+				using type = std::true_type;
+			};
+	}
+
+	template<typename Context>
+		using cache_static_sql_t = typename detail::cache_static_sql_impl<Context>::type;
+
+	// Cached text lives until the end of the program. Contexts which can reference text
+	// instead of copying it provide append_static(const char*, size_t).
+	namespace detail
+	{
+		template<typename Context, typename Enable = void>
+			struct append_static_sql_impl
+			{
+				static void _(const std::string& sql, Context& context)
+				{
+					context << sql;
+				}
+			};
+
+		template<typename Context>
+			struct append_static_sql_impl<Context, decltype(void(std::declval<Context&>().append_static(std::declval<const char*>(), std::size_t{})))>
+			{
+				static void _(const std::string& sql, Context& context)
+				{
+					context.append_static(sql.data(), sql.size());
+				}
+			};
+	}
+
+	template<typename Context>
+		Context& append_static_sql(const std::string& sql, Context& context)
+		{
+			detail::append_static_sql_impl<Context>::_(sql, context);
+			return context;
+		}
+
+	// The text of a statement or statement part without runtime data depends on its type only.
+	// It is therefore rendered once per context and Key type.
+	template<typename Context, typename Key>
+		struct static_sql_t
+		{
+			template<typename T, typename Render>
+				static const std::string& get(const T& t, Render render)
+				{
+					static const std::string sql = [&t, &render]()
+					{
+						Context context;
+						render(t, context);
+						return context.str();
+					}();
+					return sql;
+				}
+		};
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ * 
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_STRING_VIEW_H
+#define SQLPP_STRING_VIEW_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#if __cplusplus >= 201703L and defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#define SQLPP_USE_STD_STRING_VIEW
+#endif
+#endif
+
+namespace sqlpp
+{
+	// Non-owning pointer and length of a character sequence.
+	// The referenced characters must outlive the view, see the users of string_view for details.
+#ifdef SQLPP_USE_STD_STRING_VIEW
+	using string_view = std::string_view;
+#else
+	class string_view
+	{
+	public:
+		constexpr string_view() = default;
+
+		constexpr string_view(const char* data, std::size_t size):
+			_data(data),
+			_size(size)
+		{}
+
+		string_view(const char* s):
+			_data(s),
+			_size(std::strlen(s))
+		{}
+
+		string_view(const std::string& s):
+			_data(s.data()),
+			_size(s.size())
+		{}
+
+		constexpr const char* data() const
+		{
+			return _data;
+		}
+
+		constexpr std::size_t size() const
+		{
+			return _size;
+		}
+
+		constexpr bool empty() const
+		{
+			return _size == 0;
+		}
+
+		constexpr const char* begin() const
+		{
+			return _data;
+		}
+
+		constexpr const char* end() const
+		{
+			return _data + _size;
+		}
+
+		explicit operator std::string() const
+		{
+			return std::string(_data, _size);
+		}
+
+		friend bool operator==(const string_view& lhs, const string_view& rhs)
+		{
+			return lhs._size == rhs._size and (lhs._size == 0 or std::memcmp(lhs._data, rhs._data, lhs._size) == 0);
+		}
+
+		friend bool operator!=(const string_view& lhs, const string_view& rhs)
+		{
+			return not (lhs == rhs);
+		}
+
+	private:
+		const char* _data = nullptr;
+		std::size_t _size = 0;
+	};
+#endif
+}
+
+#endif
@@ -39,6 +39,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<value_type_of<Expr>, tag::is_expression, tag::is_selectable>;
 		using _nodes = detail::type_vector<Expr, aggregate_function>;
+		using _can_be_null = std::true_type; // NULL for an empty set of rows
 
 		static_assert(is_noop<Flag>::value or std::is_same<distinct_t, Flag>::value, "sum() used with flag other than 'distinct'");
 		static_assert(is_numeric_t<Expr>::value, "sum() requires a numeric expression as argument");
@@ -44,6 +44,7 @@ namespace sqlpp
 
 		using _nodes = detail::type_vector<>;
 		using _required_ctes = required_ctes_of<Table>;
+		using _has_runtime_data = has_runtime_data_t<Table>;
 		using _provided_tables = detail::type_set<Alias>;
 
 		static_assert(required_tables_of<Table>::size::value == 0, "table aliases must not depend on external tables");
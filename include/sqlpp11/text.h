@@ -33,6 +33,8 @@
 #include <sqlpp11/concat.h>
 #include <sqlpp11/like.h>
 #include <sqlpp11/result_field.h>
+#include <sqlpp11/serialize.h>
+#include <sqlpp11/string_view.h>
 
 namespace sqlpp
 {
@@ -47,6 +49,25 @@ namespace sqlpp
 			using _is_valid_operand = is_text_t<T>;
 	};
 
+	namespace detail
+	{
+		// Connectors bind text from pointer and length if they can
+		template<typename Target>
+			auto bind_text_view(Target& target, size_t index, string_view view, std::string&, int)
+			-> decltype(target._bind_text_parameter(index, view.data(), view.size(), false))
+			{
+				return target._bind_text_parameter(index, view.data(), view.size(), false);
+			}
+
+		// Older connectors only bind std::string
+		template<typename Target>
+			void bind_text_view(Target& target, size_t index, string_view view, std::string& copy, long)
+			{
+				copy.assign(view.data(), view.size());
+				target._bind_text_parameter(index, &copy, false);
+			}
+	}
+
 	// text parameter type
 	template<>
 		struct parameter_value_t<text>
@@ -66,6 +87,9 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const _cpp_value_type& val)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
 				_value = val;
 				_is_null = false;
 				return *this;
@@ -73,6 +97,9 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const tvin_t<wrap_operand_t<_cpp_value_type>>& t)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
 				if (t._is_trivial())
 				{
 					_value = "";
@@ -88,6 +115,9 @@ namespace sqlpp
 
 			parameter_value_t& operator=(const std::nullptr_t&)
 			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_is_view = false;
 				_value = "";
 				_is_null = true;
 				return *this;
@@ -98,9 +128,22 @@ namespace sqlpp
 				return _is_null; 
 			}
 
+			// Refers to the characters instead of copying them, e.g. to bind a payload from a network buffer.
+			// The characters must stay valid and unchanged until the statement has been executed.
+			// Assigning a value or null ends the reference.
+			parameter_value_t& set_view(string_view view)
+			{
+				_is_dirty = true;
+				_bound_value = nullptr;
+				_view = view;
+				_is_view = true;
+				_is_null = false;
+				return *this;
+			}
+
 			_cpp_value_type value() const
 			{
-				return _value;
+				return _is_view ? _cpp_value_type(_view.data(), _view.size()) : _value;
 			}
 
 			operator _cpp_value_type() const { return value(); }
@@ -108,12 +151,44 @@ namespace sqlpp
 			template<typename Target>
 				void _bind(Target& target, size_t index) const
 				{
-					target._bind_text_parameter(index, &_value, _is_null);
+					_is_dirty = false;
+					if (_bound_value)
+						target._bind_text_parameter(index, _bound_value, false);
+					else if (_is_view)
+						detail::bind_text_view(target, index, _view, _view_copy, 0);
+					else
+						target._bind_text_parameter(index, &_value, _is_null);
+				}
+
+			template<typename Target>
+				static void _bind_array(Target& target, size_t index, const _cpp_value_type* values, null_bitmap_ref_t is_null, size_t count)
+				{
+					target._bind_text_parameter_array(index, values, is_null, count);
 				}
 
+			// Modified since the last _bind(), see parameter_list_t::_bind(). Values owned by the caller might change any time.
+			bool _is_modified() const
+			{
+				return _is_dirty or _bound_value or _is_view;
+			}
+
+			// Bind a value owned by the caller instead, see parameter_binding.h
+			using _bind_value_type = _cpp_value_type;
+
+			void _bind_to(const _bind_value_type* value)
+			{
+				_is_dirty = true;
+				_bound_value = value;
+			}
+
 		private:
 			_cpp_value_type _value;
 			bool _is_null;
+			const _bind_value_type* _bound_value = nullptr;
+			mutable detail::dirty_flag_t _is_dirty;
+			string_view _view;
+			bool _is_view = false;
+			mutable std::string _view_copy;
 		};
 
 
@@ -166,60 +241,45 @@ namespace sqlpp
 	{
 		static_assert(std::is_same<value_type_of<FieldSpec>, text>::value, "field type mismatch");
 		using _cpp_value_type = typename text::_cpp_value_type;
+		using _bind_value_type = _cpp_value_type;
 
 		result_field_t():
-			_is_valid(false),
 			_value_ptr(nullptr),
 			_len(0)
 		{}
 
-		void _validate()
-		{
-			_is_valid = true;
-		}
-
-		void _invalidate()
-		{
-			_is_valid = false;
-			_value_ptr = nullptr;
-			_len = 0;
-		}
-
-		bool operator==(const _cpp_value_type& rhs) const { return value() == rhs; }
+		bool operator==(const _cpp_value_type& rhs) const { return view() == string_view(rhs); }
 		bool operator!=(const _cpp_value_type& rhs) const { return not operator==(rhs); }
 
 		bool is_null() const
 		{ 
-			if (not _is_valid)
-				throw exception("accessing is_null in non-existing row");
 			return _value_ptr == nullptr; 
 		}
 
 		bool _is_trivial() const
 		{
-			if (not _is_valid)
-				throw exception("accessing is_null in non-existing row");
-
-			return value() == "";
+			return view().empty();
 		}
 
-		_cpp_value_type value() const
+		// The characters as provided by the connector, valid until the next row is fetched
+		string_view view() const
 		{
-			if (not _is_valid)
-				throw exception("accessing value in non-existing row");
-
 			if (not _value_ptr)
 			{
 				if (enforce_null_result_treatment_t<Db>::value and not null_is_trivial_value_t<FieldSpec>::value)
 				{
 					throw exception("accessing value of NULL field");
 				}
-				else
-				{
-					return "";
-				}
+				return {};
 			}
-			return std::string(_value_ptr, _value_ptr + _len);
+			return {_value_ptr, _len};
+		}
+
+		// A copy of the characters
+		_cpp_value_type value() const
+		{
+			const auto chars = view();
+			return _cpp_value_type(chars.data(), chars.size());
 		}
 
 		template<typename Target>
@@ -228,8 +288,14 @@ namespace sqlpp
 				target._bind_text_result(i, &_value_ptr, &_len);
 			}
 
+		// Column arrays for fetching batches of rows, see column_batch.h
+		template<typename Target>
+			static void _bind_array(Target& target, size_t index, _bind_value_type* values, null_bitmap_ref_t is_null, size_t count)
+			{
+				target._bind_text_result_array(index, values, is_null, count);
+			}
+
 	private:
-		bool _is_valid;
 		const char* _value_ptr;
 		size_t _len;
 	};
@@ -248,7 +314,10 @@ namespace sqlpp
 				}
 				else
 				{
-					context << '\'' << context.escape(t.value()) << '\'';
+					const auto chars = t.view();
+					context << '\'';
+					serialize_escaped(chars.data(), chars.size(), context);
+					context << '\'';
 				}
 				return context;
 			}
@@ -263,11 +332,11 @@ namespace sqlpp
 			}
 			else
 			{
-				return os << e.value();
+				const auto chars = e.view();
+				return os.write(chars.data(), static_cast<std::streamsize>(chars.size()));
 			}
 		}
 
-	using blob = text;
 	using varchar = text;
 	using char_ = text;
 
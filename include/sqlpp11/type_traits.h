@@ -77,6 +77,7 @@ namespace sqlpp
 		detail::is_element_of<tag::is_floating_point, typename T::_traits::_tags>::value>;
 
 	SQLPP_VALUE_TRAIT_GENERATOR(is_text)
+	SQLPP_VALUE_TRAIT_GENERATOR(is_blob)
 	SQLPP_VALUE_TRAIT_GENERATOR(is_wrapped_value)
 	SQLPP_VALUE_TRAIT_GENERATOR(is_selectable)
 	SQLPP_VALUE_TRAIT_GENERATOR(is_expression)
@@ -200,6 +201,43 @@ namespace sqlpp
 	SQLPP_RECURSIVE_TRAIT_GENERATOR(can_be_null)
 	SQLPP_RECURSIVE_TRAIT_GENERATOR(contains_aggregate_function)
 
+	// Runtime data is everything that is serialized, but not determined by the type alone,
+	// e.g. literal values or dynamically added parts. Types that serialize values or
+	// sub-expressions which are not listed in _nodes have to declare _has_runtime_data.
+	namespace detail
+	{
+		template<typename T, typename Enable = void>
+			struct is_dynamic_part_impl
+			{
+				using type = std::false_type;
+			};
+		template<typename T>
+			struct is_dynamic_part_impl<T, typename std::enable_if<std::is_class<typename T::_is_dynamic>::value>::type>
+			{
+				using type = typename T::_is_dynamic;
+			};
+
+		template<typename T, typename Leaf = void>
+			struct has_runtime_data_impl
+			{
+				using type = logic::any_t<
+					is_dynamic_part_impl<T>::type::value,
+					has_runtime_data_impl<typename T::_nodes>::type::value>;
+			};
+		template<typename T>
+			struct has_runtime_data_impl<T, typename std::enable_if<std::is_class<typename T::_has_runtime_data>::value>::type>
+			{
+				using type = typename T::_has_runtime_data;
+			};
+		template<typename... Nodes>
+			struct has_runtime_data_impl<type_vector<Nodes...>, void>
+			{
+				using type = logic::any_t<has_runtime_data_impl<Nodes>::type::value...>;
+			};
+	}
+	template<typename T>
+		using has_runtime_data_t = typename detail::has_runtime_data_impl<T>::type;
+
 	namespace detail
 	{
 		template<typename T, typename Leaf = void>
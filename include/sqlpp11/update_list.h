@@ -50,6 +50,11 @@ namespace sqlpp
 
 			std::tuple<Assignments...> _assignments;
 			interpretable_list_t<Database> _dynamic_assignments;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_assignments, arena);
+			}
 		};
 
 	struct assert_no_unknown_tables_in_update_assignments_t
@@ -51,6 +51,11 @@ namespace sqlpp
 
 			std::tuple<Tables...> _tables;
 			interpretable_list_t<Database> _dynamic_tables;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_tables, arena);
+			}
 		};
 
 	// USING
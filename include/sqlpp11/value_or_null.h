@@ -52,6 +52,7 @@ namespace sqlpp
 
 			using _traits = make_traits<ValueType, tag::is_expression>;
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 
 			value_or_null_t(_cpp_value_type value):
 				_value(value),
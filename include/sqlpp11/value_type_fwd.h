@@ -32,6 +32,38 @@
 
 namespace sqlpp
 {
+	namespace detail
+	{
+		// Tracks modifications of a parameter_value_t since its last _bind().
+		// Copies are always modified, e.g. after params = snapshot, the values differ from what
+		// a connector that keeps bindings has seen at the same address.
+		class dirty_flag_t
+		{
+			bool _value = true;
+
+		public:
+			dirty_flag_t() = default;
+			dirty_flag_t(const dirty_flag_t&) {}
+			dirty_flag_t& operator=(const dirty_flag_t&)
+			{
+				_value = true;
+				return *this;
+			}
+			~dirty_flag_t() = default;
+
+			dirty_flag_t& operator=(bool value)
+			{
+				_value = value;
+				return *this;
+			}
+
+			operator bool() const
+			{
+				return _value;
+			}
+		};
+	}
+
 	template<typename ValueType>
 		struct parameter_value_t
 		{
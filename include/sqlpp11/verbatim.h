@@ -40,6 +40,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<ValueType, tag::is_expression>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 		using _can_be_null = std::true_type; // since we do not know what's going on inside the verbatim, we assume it can be null
 
 		verbatim_t(std::string verbatim): _verbatim(verbatim) {}
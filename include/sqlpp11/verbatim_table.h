@@ -51,6 +51,7 @@ namespace sqlpp
 	struct verbatim_table_t: public table_t<verbatim_table_t, detail::unusable_pseudo_column_t>
 	{
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 
 		struct _alias_t
 		{
@@ -53,6 +53,11 @@ namespace sqlpp
 
 			std::tuple<Expressions...> _expressions;
 			interpretable_list_t<Database> _dynamic_expressions;
+
+			void _use_arena(const std::shared_ptr<arena_t>& arena)
+			{
+				detail::use_arena(_dynamic_expressions, arena);
+			}
 		};
 
 	struct assert_no_unknown_tables_in_where_t
@@ -150,6 +155,7 @@ namespace sqlpp
 		{
 			using _traits = make_traits<no_value_t, tag::is_where>;
 			using _nodes = detail::type_vector<>;
+			using _has_runtime_data = std::true_type;
 
 			// Data
 			using _data_t = where_data_t<void, bool>;
@@ -71,6 +71,7 @@ namespace sqlpp
 			using _parameters = detail::type_vector_cat_t<parameters_of<Expressions>...>;
 
 			using _is_dynamic = is_database<Database>;
+			using _has_runtime_data = logic::any_t<_is_dynamic::value, has_runtime_data_t<Expressions>::value...>;
 
 			// Data
 			using _data_t = with_data_t<Database, Expressions...>;
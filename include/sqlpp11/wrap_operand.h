@@ -27,9 +27,11 @@
 #ifndef SQLPP_DETAIL_WRAP_OPERAND_H
 #define SQLPP_DETAIL_WRAP_OPERAND_H
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <sqlpp11/wrap_operand_fwd.h>
-#include <sqlpp11/serializer.h>
+#include <sqlpp11/serialize.h>
 #include <sqlpp11/concepts.h>
 #include <sqlpp11/basic_expression_operators.h>
 
@@ -39,11 +41,13 @@ namespace sqlpp
 	struct integral;
 	struct floating_point;
 	struct text;
+	struct blob;
 
 	struct boolean_operand: public alias_operators<boolean_operand>
 	{
 		using _traits = make_traits<boolean, tag::is_expression, tag::is_wrapped_value>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 
 		using _value_t = bool;
 
@@ -83,6 +87,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<integral, tag::is_expression, tag::is_wrapped_value>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 
 		using _value_t = int64_t;
 
@@ -113,8 +118,7 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << t._t;
-				return context;
+				return serialize_integral(t._t, context);
 			}
 		};
 
@@ -123,6 +127,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<floating_point, tag::is_expression, tag::is_wrapped_value>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 
 		using _value_t = double;
 
@@ -153,8 +158,7 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << t._t;
-				return context;
+				return serialize_floating_point(t._t, context);
 			}
 		};
 
@@ -162,6 +166,7 @@ namespace sqlpp
 	{
 		using _traits = make_traits<text, tag::is_expression, tag::is_wrapped_value>;
 		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
 
 		using _value_t = std::string;
 
@@ -192,11 +197,52 @@ namespace sqlpp
 
 			static Context& _(const Operand& t, Context& context)
 			{
-				context << '\'' << context.escape(t._t) << '\'';
+				context << '\'';
+				serialize_escaped(t._t.data(), t._t.size(), context);
+				context << '\'';
 				return context;
 			}
 		};
 
+	struct blob_operand: public alias_operators<blob_operand>
+	{
+		using _traits = make_traits<blob, tag::is_expression, tag::is_wrapped_value>;
+		using _nodes = detail::type_vector<>;
+		using _has_runtime_data = std::true_type;
+
+		using _value_t = std::vector<std::uint8_t>;
+
+		blob_operand():
+			_t{}
+		{}
+
+		blob_operand(_value_t t):
+			_t(std::move(t))
+		{}
+
+		blob_operand(const blob_operand&) = default;
+		blob_operand(blob_operand&&) = default;
+		blob_operand& operator=(const blob_operand&) = default;
+		blob_operand& operator=(blob_operand&&) = default;
+		~blob_operand() = default;
+
+		bool _is_trivial() const { return _t.empty(); }
+
+		_value_t _t;
+	};
+
+	template<typename Context>
+		struct serializer_t<Context, blob_operand>
+		{
+			using _serialize_check = consistent_t;
+			using Operand = blob_operand;
+
+			static Context& _(const Operand& t, Context& context)
+			{
+				return serialize_hex(t._t.data(), t._t.size(), context);
+			}
+		};
+
 	template<typename T, typename Enable>
 		struct wrap_operand
 		{
@@ -227,6 +273,12 @@ namespace sqlpp
 			using type = text_operand;
 		};
 
+	template<>
+		struct wrap_operand<std::vector<std::uint8_t>, void>
+		{
+			using type = blob_operand;
+		};
+
 }
 
 #endif
@@ -26,48 +26,126 @@
 #ifndef SQLPP_MOCK_DB_H
 #define SQLPP_MOCK_DB_H
 
-#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__unix__) or defined(__APPLE__)
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
 #include <sqlpp11/serializer_context.h>
+#include <sqlpp11/chunked_context.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/serialized_size.h>
+#include <sqlpp11/prepared_statement_cache.h>
+#include <sqlpp11/batch.h>
+#include <sqlpp11/async.h>
+#include <sqlpp11/pipeline.h>
 #include <sqlpp11/connection.h>
 
-template<bool enforceNullResultTreatment>
-struct MockDbT: public sqlpp::connection
+// Stand-in for the network and server of a real connection: operations complete
+// on a worker thread once the latency has passed. Operations in flight overlap.
+class MockExecutor
 {
-	using _traits = ::sqlpp::make_traits<::sqlpp::no_value_t, 
-						::sqlpp::tag_if<::sqlpp::tag::enforce_null_result_treatment, enforceNullResultTreatment>
-					>;
-
-	struct _serializer_context_t
+	using _clock_t = std::chrono::steady_clock;
+	struct _operation_t
 	{
-		std::ostringstream _os;
+		_clock_t::time_point due;
+		size_t sequence;
+		std::function<void()> task;
 
-		_serializer_context_t() = default;
-		_serializer_context_t(const _serializer_context_t& rhs)	
+		bool operator<(const _operation_t& rhs) const
 		{
-			_os << rhs._os.str();
+			return due > rhs.due or (due == rhs.due and sequence > rhs.sequence);
 		}
+	};
+
+public:
+	explicit MockExecutor(std::chrono::microseconds latency):
+		_latency(latency),
+		_worker([this](){ _work(); })
+	{}
 
-		std::string str() const
+	MockExecutor(const MockExecutor&) = delete;
+	MockExecutor& operator=(const MockExecutor&) = delete;
+
+	~MockExecutor()
+	{
 		{
-			return _os.str();
+			std::lock_guard<std::mutex> lock(_mutex);
+			_done = true;
 		}
+		_wake.notify_one();
+		_worker.join();
+	}
 
-		void reset()
+	void post(std::function<void()> task)
+	{
 		{
-			_os.str("");
+			std::lock_guard<std::mutex> lock(_mutex);
+			_operations.push({_clock_t::now() + _latency, _sequence++, std::move(task)});
 		}
+		_wake.notify_one();
+	}
 
-		template<typename T>
-			std::ostream& operator<<(T t)
+private:
+	void _work()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		while (true)
+		{
+			if (_operations.empty())
 			{
-				return _os << t;
+				if (_done)
+					return;
+				_wake.wait(lock);
+			}
+			else if (_clock_t::now() < _operations.top().due)
+			{
+				_wake.wait_until(lock, _operations.top().due);
+			}
+			else
+			{
+				auto task = std::move(const_cast<_operation_t&>(_operations.top()).task);
+				_operations.pop();
+				lock.unlock();
+				task();
+				lock.lock();
 			}
-
-		static std::string escape(std::string arg)
-		{
-			return sqlpp::serializer_context_t::escape(arg);
 		}
+	}
+
+	const std::chrono::microseconds _latency;
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	std::priority_queue<_operation_t> _operations;
+	size_t _sequence = 0;
+	bool _done = false;
+	std::thread _worker;
+};
+
+template<bool enforceNullResultTreatment>
+struct MockDbT: public sqlpp::connection
+{
+	using _traits = ::sqlpp::make_traits<::sqlpp::no_value_t, 
+						::sqlpp::tag_if<::sqlpp::tag::enforce_null_result_treatment, enforceNullResultTreatment>
+					>;
+
+	struct _serializer_context_t: public sqlpp::serializer_context_t
+	{
+		using _cache_static_sql = sqlpp::cache_static_sql_for<_serializer_context_t>;
 	};
 
 	using _interpreter_context_t = _serializer_context_t;
@@ -91,9 +169,17 @@ struct MockDbT: public sqlpp::connection
 		return context;
 	}
 
+	// Yields the given number of generated rows
 	class result_t
 	{
 	public:
+		result_t() = default;
+
+		explicit result_t(size_t rows, std::chrono::microseconds fetch_latency = std::chrono::microseconds{0}):
+			_rows(rows),
+			_fetch_latency(fetch_latency)
+		{}
+
 		constexpr bool operator==(const result_t& rhs) const
 		{
 			return true;
@@ -102,10 +188,105 @@ struct MockDbT: public sqlpp::connection
 		template<typename ResultRow>
 			void next(ResultRow& result_row)
 			{
-				result_row._invalidate();
+				if (_row == _rows)
+				{
+					result_row._invalidate();
+					return;
+				}
+				if (not result_row)
+					result_row._validate();
+				result_row._bind(*this);
+				++_row;
 			}
+
+		// All fields are reported in one go, the fields get no NULL indicator of their own
+		void _bind_null_bitmap(sqlpp::null_bitmap_ref_t is_null, size_t count)
+		{
+			is_null.fill(0, count, false);
+		}
+
+		void _bind_boolean_result(size_t, signed char* value, bool*)
+		{
+			*value = _row % 2;
+		}
+
+		void _bind_floating_point_result(size_t, double* value, bool*)
+		{
+			*value = static_cast<double>(_row) / 2;
+		}
+
+		void _bind_integral_result(size_t, int64_t* value, bool*)
+		{
+			*value = static_cast<int64_t>(_row);
+		}
+
+		void _bind_text_result(size_t, const char** text, size_t* len)
+		{
+			*text = _text;
+			*len = _text_size;
+		}
+
+		// Bulk retrieval, see sqlpp11/column_batch.h
+		template<typename ColumnBatch>
+			void _fetch_columns(ColumnBatch& batch)
+			{
+				if (_fetch_latency.count())
+					std::this_thread::sleep_for(_fetch_latency); // round trip per batch
+				_array_rows = std::min(batch._free(), _rows - _row);
+				batch._bind(*this);
+				_row += _array_rows;
+				batch._grow(_array_rows);
+			}
+
+		void _bind_boolean_result_array(size_t, signed char* values, sqlpp::null_bitmap_ref_t is_null, size_t)
+		{
+			for (size_t i = 0; i < _array_rows; ++i)
+			{
+				values[i] = (_row + i) % 2;
+			}
+			is_null.fill(0, _array_rows, false);
+		}
+
+		void _bind_floating_point_result_array(size_t, double* values, sqlpp::null_bitmap_ref_t is_null, size_t)
+		{
+			for (size_t i = 0; i < _array_rows; ++i)
+			{
+				values[i] = static_cast<double>(_row + i) / 2;
+			}
+			is_null.fill(0, _array_rows, false);
+		}
+
+		void _bind_integral_result_array(size_t, int64_t* values, sqlpp::null_bitmap_ref_t is_null, size_t)
+		{
+			for (size_t i = 0; i < _array_rows; ++i)
+			{
+				values[i] = static_cast<int64_t>(_row + i);
+			}
+			is_null.fill(0, _array_rows, false);
+		}
+
+		void _bind_text_result_array(size_t, std::string* values, sqlpp::null_bitmap_ref_t is_null, size_t)
+		{
+			for (size_t i = 0; i < _array_rows; ++i)
+			{
+				values[i].assign(_text, _text_size);
+			}
+			is_null.fill(0, _array_rows, false);
+		}
+
+	private:
+		static constexpr const char* _text = "cheesecake with strawberries"; // too long for the small string optimization
+		static constexpr size_t _text_size = 28;
+		size_t _rows = 0;
+		size_t _row = 0;
+		size_t _array_rows = 0;
+		std::chrono::microseconds _fetch_latency{0};
 	};
 
+	// Number of rows in the results of selects and the simulated latency of fetching a batch of them
+	size_t _result_rows = 0;
+	std::chrono::microseconds _fetch_latency{0};
+
 	// Directly executed statements start here
 	template<typename T>
 		auto _run(const T& t, const std::true_type&) -> decltype(t._run(*this))
@@ -126,6 +307,28 @@ struct MockDbT: public sqlpp::connection
 			return _run(t, _ok{});
 		}
 
+	// Asynchronous execution, see sqlpp11/async.h
+	std::chrono::microseconds _async_latency{0};
+	std::unique_ptr<MockExecutor> _executor;
+
+	~MockDbT()
+	{
+		_executor.reset(); // complete the operations in flight while the connection is intact
+	}
+
+	void _post(std::function<void()> task)
+	{
+		if (not _executor)
+			_executor.reset(new MockExecutor(_async_latency));
+		_executor->post(std::move(task));
+	}
+
+	template<typename T>
+		auto async(const T& t) -> decltype(sqlpp::async(*this, t))
+		{
+			return sqlpp::async(*this, t);
+		}
+
 	size_t execute(const std::string& command)
 	{
 		return 0;
@@ -144,16 +347,86 @@ struct MockDbT: public sqlpp::connection
 	template<typename Insert>
 		size_t insert(const Insert& x)
 		{
+			if (_reading_replies)
+				return 0;
 			_serializer_context_t context;
+			if (_statement_cache.enabled())
+			{
+				_prepare_cached(x, context);
+				return 0;
+			}
+			if (_reserve_serialized_size)
+				context.reserve(::sqlpp::serialized_size(x, context));
 			::sqlpp::serialize(x, context);
 			std::cout << "Running insert call with\n" << context.str() << std::endl;
 			return 0;
 		}
 
+	// The sizing pass pays off for huge statements only (e.g. bulk inserts), see benchmarks/BulkInsert.cpp
+	bool _reserve_serialized_size = false;
+
+	// Stand-in for a vectored write to the socket of a real connection, the chunks are discarded unless a test sets a file
+#if defined(_WIN32)
+	std::string _chunk_file = "NUL";
+#else
+	std::string _chunk_file = "/dev/null";
+#endif
+
+	size_t _write_chunks(const sqlpp::chunk_t* chunks, size_t count)
+	{
+		size_t written = 0;
+#if defined(__unix__) or defined(__APPLE__)
+		const auto fd = ::open(_chunk_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0)
+			throw sqlpp::exception("MockDb: cannot open " + _chunk_file);
+		std::vector<iovec> segments;
+		while (count)
+		{
+			const auto batch = std::min<size_t>(count, IOV_MAX);
+			segments.clear();
+			for (size_t i = 0; i < batch; ++i)
+				segments.push_back({const_cast<char*>(chunks[i].data), chunks[i].size});
+			const auto result = ::writev(fd, segments.data(), static_cast<int>(batch));
+			if (result < 0)
+			{
+				::close(fd);
+				throw sqlpp::exception("MockDb: cannot write to " + _chunk_file);
+			}
+			written += static_cast<size_t>(result);
+			chunks += batch;
+			count -= batch;
+		}
+		::close(fd);
+#else
+		std::ofstream file(_chunk_file, std::ios::binary | std::ios::trunc);
+		for (size_t i = 0; i < count; ++i)
+		{
+			file.write(chunks[i].data, static_cast<std::streamsize>(chunks[i].size));
+			written += chunks[i].size;
+		}
+#endif
+		return written;
+	}
+
+	template<typename Statement>
+		size_t execute_chunked(const Statement& x)
+		{
+			sqlpp::chunked_context_t context;
+			::sqlpp::serialize(x, context);
+			return _write_chunks(context.chunks().data(), context.chunks().size());
+		}
+
 	template<typename Update>
 		size_t update(const Update& x)
 		{
+			if (_reading_replies)
+				return 0;
 			_serializer_context_t context;
+			if (_statement_cache.enabled())
+			{
+				_prepare_cached(x, context);
+				return 0;
+			}
 			::sqlpp::serialize(x, context);
 			std::cout << "Running update call with\n" << context.str() << std::endl;
 			return 0;
@@ -162,7 +435,14 @@ struct MockDbT: public sqlpp::connection
 	template<typename Remove>
 		size_t remove(const Remove& x)
 		{
+			if (_reading_replies)
+				return 0;
 			_serializer_context_t context;
+			if (_statement_cache.enabled())
+			{
+				_prepare_cached(x, context);
+				return 0;
+			}
 			::sqlpp::serialize(x, context);
 			std::cout << "Running remove call with\n" << context.str() << std::endl;
 			return 0;
@@ -171,15 +451,97 @@ struct MockDbT: public sqlpp::connection
 	template<typename Select>
 		result_t select(const Select& x)
 		{
+			if (_reading_replies)
+				return result_t{_result_rows, _fetch_latency};
 			_serializer_context_t context;
+			if (_statement_cache.enabled())
+			{
+				_prepare_cached(x, context);
+				return {};
+			}
 			::sqlpp::serialize(x, context);
 			std::cout << "Running select call with\n" << context.str() << std::endl;
-			return {};
+			return result_t{_result_rows, _fetch_latency};
+		}
+
+	// Pipelining: all statements are sent in one round trip, then the replies are read in order
+	size_t _pipeline_count = 0;
+	bool _reading_replies = false;
+
+	// Resets _reading_replies if reading a reply throws
+	struct _reading_replies_guard_t
+	{
+		bool& _reading_replies;
+
+		explicit _reading_replies_guard_t(bool& reading_replies):
+			_reading_replies(reading_replies)
+		{
+			_reading_replies = true;
+		}
+
+		~_reading_replies_guard_t()
+		{
+			_reading_replies = false;
+		}
+	};
+
+	template<typename... Statements>
+		sqlpp::pipeline_result_t<MockDbT, Statements...> run_pipeline(const Statements&... statements)
+		{
+			return sqlpp::run_pipeline(*this, statements...);
+		}
+
+	template<typename... Statements>
+		sqlpp::pipeline_result_t<MockDbT, Statements...> _run_pipeline(const Statements&... statements)
+		{
+			_serializer_context_t context;
+			using swallow = int[];
+			(void) swallow{0, (_send(statements, context, sqlpp::is_prepared_statement_t<Statements>{}), 0)...};
+			++_pipeline_count;
+			std::cout << "Running pipeline with\n" << context.str() << std::endl;
+
+			const _reading_replies_guard_t guard(_reading_replies);
+			return sqlpp::run_pipeline_sequentially(*this, statements...);
+		}
+
+	template<typename Statement>
+		void _send(const Statement& x, _serializer_context_t& context, const std::false_type&)
+		{
+			::sqlpp::serialize(x, context);
+			context << ";\n";
+		}
+
+	template<typename PreparedStatement>
+		void _send(const PreparedStatement&, _serializer_context_t& context, const std::true_type&)
+		{
+			context << "EXECUTE <prepared statement>;\n";
 		}
 
 	// Prepared statements start here
 	using _prepared_statement_t = std::nullptr_t;
 
+	// Counts the statements prepared by the database
+	size_t _prepare_count = 0;
+
+	// Opt-in: directly executed statements are prepared once and then reused
+	sqlpp::prepared_statement_cache_t<_prepared_statement_t> _statement_cache;
+
+	sqlpp::prepared_statement_cache_t<_prepared_statement_t>& statement_cache()
+	{
+		return _statement_cache;
+	}
+
+	template<typename Statement>
+		_prepared_statement_t& _prepare_cached(const Statement& x, _serializer_context_t& context)
+		{
+			return sqlpp::prepare_cached(_statement_cache, x, context, [this, &context]()
+					{
+						++_prepare_count;
+						std::cout << "Running cached prepare call with\n" << context.str() << std::endl;
+						return _prepared_statement_t{};
+					});
+		}
+
 	template<typename T>
 		auto _prepare(const T& t, const std::true_type&) -> decltype(t._prepare(*this))
 		{
@@ -205,6 +567,7 @@ struct MockDbT: public sqlpp::connection
 		{
 			_serializer_context_t context;
 			::sqlpp::serialize(x, context);
+			++_prepare_count;
 			std::cout << "Running prepare execute call with\n" << context.str() << std::endl;
 			return nullptr;
 		}
@@ -214,6 +577,7 @@ struct MockDbT: public sqlpp::connection
 		{
 			_serializer_context_t context;
 			::sqlpp::serialize(x, context);
+			++_prepare_count;
 			std::cout << "Running prepare insert call with\n" << context.str() << std::endl;
 			return nullptr;
 		}
@@ -230,11 +594,68 @@ struct MockDbT: public sqlpp::connection
 			return 0;
 		}
 
+	template<typename PreparedStatement, typename Range>
+		size_t run_batch(PreparedStatement& x, const Range& parameter_sets)
+		{
+			return sqlpp::run_batch(*this, x, parameter_sets);
+		}
+
+	// Counts the batches sent in one round trip
+	size_t _batch_count = 0;
+
+	// Values of the last batch per parameter index, as text or "NULL"
+	std::vector<std::vector<std::string>> _batch_values;
+
+	template<typename PreparedStatement, typename ParameterArrays>
+		size_t run_prepared_batch(const PreparedStatement& x, const ParameterArrays& arrays)
+		{
+			++_batch_count;
+			_batch_values.clear();
+			arrays._bind(*this);
+			return arrays.size();
+		}
+
+	template<typename Value, typename ToString>
+		void _record_batch_values(size_t index, const Value* values, sqlpp::null_bitmap_ref_t is_null, size_t count, ToString to_string)
+		{
+			if (_batch_values.size() <= index)
+				_batch_values.resize(index + 1);
+			auto& column = _batch_values[index];
+			for (size_t i = 0; i < count; ++i)
+				column.push_back(is_null.test(i) ? "NULL" : to_string(values[i]));
+		}
+
+	void _bind_boolean_parameter_array(size_t index, const signed char* values, sqlpp::null_bitmap_ref_t is_null, size_t count)
+	{
+		_record_batch_values(index, values, is_null, count, [](signed char value) { return std::to_string(static_cast<int>(value)); });
+	}
+
+	void _bind_floating_point_parameter_array(size_t index, const double* values, sqlpp::null_bitmap_ref_t is_null, size_t count)
+	{
+		_record_batch_values(index, values, is_null, count, [](double value) { return std::to_string(value); });
+	}
+
+	void _bind_integral_parameter_array(size_t index, const int64_t* values, sqlpp::null_bitmap_ref_t is_null, size_t count)
+	{
+		_record_batch_values(index, values, is_null, count, [](int64_t value) { return std::to_string(value); });
+	}
+
+	void _bind_text_parameter_array(size_t index, const std::string* values, sqlpp::null_bitmap_ref_t is_null, size_t count)
+	{
+		_record_batch_values(index, values, is_null, count, [](const std::string& value) { return value; });
+	}
+
+	void _bind_blob_parameter_array(size_t index, const std::vector<std::uint8_t>* values, sqlpp::null_bitmap_ref_t is_null, size_t count)
+	{
+		_record_batch_values(index, values, is_null, count, [](const std::vector<std::uint8_t>& value) { return std::string(value.begin(), value.end()); });
+	}
+
 	template<typename Select>
 		_prepared_statement_t prepare_select(Select& x)
 		{
 			_serializer_context_t context;
 			::sqlpp::serialize(x, context);
+			++_prepare_count;
 			std::cout << "Running prepare select call with\n" << context.str() << std::endl;
 			return nullptr;
 		}
@@ -242,7 +663,7 @@ struct MockDbT: public sqlpp::connection
 	template<typename PreparedSelect>
 		result_t run_prepared_select(PreparedSelect& x)
 		{
-			return {};
+			return result_t{_result_rows, _fetch_latency};
 		}
 
 };
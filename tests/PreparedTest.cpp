@@ -28,9 +28,132 @@
 #include "is_regular.h"
 #include <sqlpp11/functions.h>
 #include <sqlpp11/select.h>
+#include <sqlpp11/update.h>
+#include <sqlpp11/remove.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/parameter_binding.h>
+#include <sqlpp11/async.h>
+#include <sqlpp11/pipeline.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
+namespace
+{
+	// Records bound parameter arrays
+	// Records the addresses of bound parameters
+	struct address_target_t
+	{
+		void _bind_boolean_parameter(size_t, const signed char* value, bool)
+		{
+			gamma = value;
+		}
+
+		void _bind_integral_parameter(size_t, const int64_t* value, bool)
+		{
+			delta = value;
+		}
+
+		void _bind_text_parameter(size_t, const std::string* value, bool)
+		{
+			beta = value;
+		}
+
+		const std::string* beta = nullptr;
+		const int64_t* delta = nullptr;
+		const signed char* gamma = nullptr;
+	};
+
+	// Binds text from pointer and length
+	struct view_target_t
+	{
+		void _bind_text_parameter(size_t, const std::string* value, bool)
+		{
+			data = value->data();
+			size = value->size();
+		}
+
+		void _bind_text_parameter(size_t, const char* value, size_t len, bool)
+		{
+			data = value;
+			size = len;
+		}
+
+		const char* data = nullptr;
+		size_t size = 0;
+	};
+
+	// Binds blobs from pointer and length
+	struct blob_target_t
+	{
+		void _bind_blob_parameter(size_t, const std::uint8_t* value, size_t len, bool)
+		{
+			data = value;
+			size = len;
+		}
+
+		const std::uint8_t* data = nullptr;
+		size_t size = 0;
+	};
+
+	// Counts bind calls per parameter type
+	struct counting_target_t
+	{
+		void _bind_boolean_parameter(size_t, const signed char*, bool)
+		{
+			++gamma;
+		}
+
+		void _bind_integral_parameter(size_t, const int64_t*, bool)
+		{
+			++delta;
+		}
+
+		void _bind_text_parameter(size_t, const std::string*, bool)
+		{
+			++beta;
+		}
+
+		int beta = 0;
+		int delta = 0;
+		int gamma = 0;
+	};
+
+	struct keeping_db_t
+	{
+		using _keeps_parameter_bindings = std::true_type;
+	};
+
+	// Connection without an executor of its own, records the order and overlapping of operations
+	struct unposted_db_t
+	{
+		size_t operator()(int i)
+		{
+			if (running++ != 0)
+				overlapped = true;
+			while (not released)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+			order.push_back(i);
+			--running;
+			return 1;
+		}
+
+		std::atomic<int> running{0};
+		std::atomic<bool> overlapped{false};
+		std::atomic<bool> released{true};
+		std::vector<int> order;
+	};
+
+	struct row_t
+	{
+		int64_t delta;
+		std::string beta;
+		signed char gamma;
+	};
+}
 
 int main()
 {
@@ -122,5 +245,329 @@ int main()
 		P p;
 	}
 
+	// Directly executed statements are prepared once if the statement cache is enabled
+	{
+		MockDb cached = {};
+		cached.statement_cache().set_capacity(2);
+		const auto prepare_count = cached._prepare_count;
+		for (int i = 0; i < 3; ++i)
+		{
+			cached(select(t.alpha).from(t).where(t.alpha > 7));
+			cached(update(t).set(t.gamma = false).where(t.alpha == 7));
+		}
+		if (cached._prepare_count != prepare_count + 2 or cached.statement_cache().hits() != 4 or cached.statement_cache().misses() != 2)
+		{
+			std::cerr << "statements not reused" << std::endl;
+			return 1;
+		}
+
+		// Literal values are part of the prepared SQL
+		cached(select(t.alpha).from(t).where(t.alpha > 8));
+		if (cached._prepare_count != prepare_count + 3 or cached.statement_cache().size() != 2)
+		{
+			std::cerr << "statement with different values reused" << std::endl;
+			return 1;
+		}
+
+		// The least recently used statement is dropped
+		cached(remove_from(t).where(t.alpha == 7));
+		cached(select(t.alpha).from(t).where(t.alpha > 8));
+		cached(update(t).set(t.gamma = false).where(t.alpha == 7));
+		if (cached._prepare_count != prepare_count + 5 or cached.statement_cache().size() != 2)
+		{
+			std::cerr << "least recently used statement not dropped" << std::endl;
+			return 1;
+		}
+	}
+
+	// A disabled statement cache prepares on every call and keeps no entries
+	{
+		sqlpp::prepared_statement_cache_t<int> disabled;
+		int prepare_count = 0;
+		const auto prepare = [&prepare_count]() { return ++prepare_count; };
+		if (disabled.get("SELECT 1", prepare) != 1 or disabled.get("SELECT 1", prepare) != 2 or disabled.size() != 0 or disabled.hits() != 0)
+		{
+			std::cerr << "disabled statement cache stored a statement" << std::endl;
+			return 1;
+		}
+	}
+
+	// Batches are executed in one round trip by connectors with array binding
+	{
+		auto p = db.prepare(insert_into(t).set(t.delta = parameter(t.delta), t.beta = parameter(t.beta), t.gamma = parameter(t.gamma)));
+		std::vector<decltype(p.params)> rows(3);
+		for (int i = 0; i < 3; ++i)
+		{
+			rows[i].delta = i;
+			rows[i].beta = std::to_string(i);
+			rows[i].gamma = (i == 1);
+		}
+		rows[2].gamma = nullptr;
+
+		const auto batch_count = db._batch_count;
+		if (db.run_batch(p, rows) != 3 or db._batch_count != batch_count + 1)
+		{
+			std::cerr << "batch not executed in one round trip" << std::endl;
+			return 1;
+		}
+
+		const auto expected = std::vector<std::vector<std::string>>{{"0", "1", "2"}, {"0", "1", "2"}, {"0", "1", "NULL"}};
+		if (db._batch_values != expected)
+		{
+			std::cerr << "parameter arrays not bound correctly" << std::endl;
+			return 1;
+		}
+
+		// Row by row fallback
+		sqlpp::run_batch_row_by_row(db, p, rows);
+		if (db._batch_count != batch_count + 1 or p.params.delta.value() != 2)
+		{
+			std::cerr << "batch not executed row by row" << std::endl;
+			return 1;
+		}
+	}
+
+	// Parameters can be bound to the members of a struct without copying them
+	{
+		auto p = db.prepare(insert_into(t).set(t.delta = parameter(t.delta), t.beta = parameter(t.beta), t.gamma = parameter(t.gamma)));
+		auto binding = sqlpp::bind_members(p, &row_t::delta, &row_t::beta, &row_t::gamma);
+		const auto row = row_t{17, "cheese", true};
+		binding.set(row);
+		address_target_t target;
+		p.params._bind(target);
+		if (target.delta != &row.delta or target.beta != &row.beta or target.gamma != &row.gamma)
+		{
+			std::cerr << "parameters not bound to struct members" << std::endl;
+			return 1;
+		}
+
+		binding.reset();
+		p.params._bind(target);
+		if (target.delta == &row.delta or target.beta == &row.beta or target.gamma == &row.gamma)
+		{
+			std::cerr << "parameters still bound to struct members" << std::endl;
+			return 1;
+		}
+
+		// Assigning a value or null ends the binding of that parameter
+		binding.set(row);
+		p.params.delta = 5;
+		p.params.beta = nullptr;
+		p.params._bind(target);
+		if (target.delta == &row.delta or *target.delta != 5 or target.beta == &row.beta or target.gamma != &row.gamma)
+		{
+			std::cerr << "assignment did not end binding to struct members" << std::endl;
+			return 1;
+		}
+	}
+
+	// Text parameters can refer to memory owned by the caller
+	{
+		auto p = db.prepare(select(t.alpha).from(t).where(t.beta == parameter(t.beta)));
+		const char buffer[] = "payload: cheesecake";
+		p.params.beta.set_view(sqlpp::string_view(buffer + 9, 10));
+
+		view_target_t view_target;
+		p.params._bind(view_target);
+		if (view_target.data != buffer + 9 or view_target.size != 10 or p.params.beta.value() != "cheesecake")
+		{
+			std::cerr << "text view not bound" << std::endl;
+			return 1;
+		}
+
+		// Connectors without pointer and length binding get a copy
+		address_target_t address_target;
+		p.params._bind(address_target);
+		if (not address_target.beta or *address_target.beta != "cheesecake")
+		{
+			std::cerr << "text view not copied" << std::endl;
+			return 1;
+		}
+
+		p.params.beta = "cake";
+		p.params._bind(view_target);
+		if (view_target.data == buffer + 9 or std::string(view_target.data, view_target.size) != "cake")
+		{
+			std::cerr << "text view still bound" << std::endl;
+			return 1;
+		}
+	}
+
+	// Blob parameters bind from pointer and length, connectors without blob support get text
+	{
+		test::TabFoo f;
+		auto p = db.prepare(insert_into(f).set(f.book = parameter(f.book)));
+		const std::uint8_t payload[] = {0x00, 0x27, 0xff};
+		p.params.book.set_view(sqlpp::span<const std::uint8_t>(payload, sizeof(payload)));
+
+		blob_target_t blob_target;
+		p.params._bind(blob_target);
+		if (blob_target.data != payload or blob_target.size != sizeof(payload))
+		{
+			std::cerr << "blob view not bound" << std::endl;
+			return 1;
+		}
+
+		address_target_t text_target;
+		p.params._bind(text_target);
+		if (not text_target.beta or *text_target.beta != std::string("\x00\x27\xff", 3))
+		{
+			std::cerr << "blob not bound as text" << std::endl;
+			return 1;
+		}
+	}
+
+	// Connectors that keep bindings only get the parameters modified since the last bind
+	{
+		static_assert(sqlpp::keeps_parameter_bindings_t<keeping_db_t>::value, "type requirement");
+		static_assert(not sqlpp::keeps_parameter_bindings_t<MockDb>::value, "type requirement");
+
+		auto p = db.prepare(insert_into(t).set(t.beta = parameter(t.beta), t.delta = parameter(t.delta), t.gamma = parameter(t.gamma)));
+		p.params.beta = "cheese";
+		p.params.delta = 17;
+		p.params.gamma = true;
+
+		counting_target_t target;
+		p.params._bind(target, std::true_type{});
+		p.params.delta = 18;
+		p.params._bind(target, std::true_type{});
+		if (target.beta != 1 or target.delta != 2 or target.gamma != 1)
+		{
+			std::cerr << "unmodified parameters rebound" << std::endl;
+			return 1;
+		}
+
+		p.params._bind(target, std::false_type{});
+		if (target.beta != 2 or target.delta != 3 or target.gamma != 2)
+		{
+			std::cerr << "parameters not rebound" << std::endl;
+			return 1;
+		}
+
+		row_t row = {5, "cake", false};
+		auto binding = sqlpp::bind_members(p, &row_t::beta, &row_t::delta, &row_t::gamma);
+		binding.set(row);
+		p.params._bind(target, std::true_type{});
+		p.params._bind(target, std::true_type{});
+		if (target.beta != 4 or target.delta != 5 or target.gamma != 4)
+		{
+			std::cerr << "bound members not rebound" << std::endl;
+			return 1;
+		}
+	}
+
+	// Without an executor, operations on the same connection run one at a time, in submission order.
+	// Operations on other connections do not wait for them.
+	{
+		unposted_db_t unposted_db;
+		unposted_db.released = false;
+		std::vector<std::future<size_t>> operations;
+		for (int i = 0; i < 10; ++i)
+			operations.push_back(sqlpp::async(unposted_db, i));
+
+		unposted_db_t other_db;
+		if (sqlpp::async(other_db, 0).wait_for(std::chrono::seconds(10)) != std::future_status::ready)
+		{
+			std::cerr << "async operation waited for another connection" << std::endl;
+			return 1;
+		}
+
+		unposted_db.released = true;
+		for (auto& operation : operations)
+			operation.get();
+		if (unposted_db.overlapped or unposted_db.order != std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9})
+		{
+			std::cerr << "async operations overlapped or out of order on one connection" << std::endl;
+			return 1;
+		}
+	}
+
+	// Restoring a copy of the parameters rebinds them, the values at the bound addresses have changed
+	{
+		auto p = db.prepare(insert_into(t).set(t.beta = parameter(t.beta), t.delta = parameter(t.delta), t.gamma = parameter(t.gamma)));
+		p.params.beta = "cheese";
+		p.params.delta = 1;
+		p.params.gamma = true;
+
+		counting_target_t target;
+		p.params._bind(target, std::true_type{});
+		const auto snapshot = p.params;
+		p.params.delta = 2;
+		p.params._bind(target, std::true_type{});
+		p.params = snapshot;
+		p.params._bind(target, std::true_type{});
+		if (target.beta != 2 or target.delta != 3 or target.gamma != 2 or p.params.delta.value() != 1)
+		{
+			std::cerr << "restored parameters not rebound" << std::endl;
+			return 1;
+		}
+	}
+
+	// Statements and prepared statements run asynchronously on the executor of the connection
+	{
+		MockDb async_db = {};
+		async_db._async_latency = std::chrono::milliseconds(1);
+
+		auto p = async_db.prepare(insert_into(t).set(t.gamma = true, t.delta = parameter(t.delta)));
+		p.params.delta = 17;
+		std::vector<std::future<size_t>> inserts;
+		for (int i = 0; i < 10; ++i)
+			inserts.push_back(async_db.async(p));
+		for (auto& insert : inserts)
+		{
+			if (insert.get() != 0)
+			{
+				std::cerr << "async insert failed" << std::endl;
+				return 1;
+			}
+		}
+
+		auto result = async_db.async(select(t.alpha).from(t).where(t.alpha > 7)).get();
+		if (not result.empty() or sqlpp::async_next(async_db, result).get())
+		{
+			std::cerr << "async select returned rows" << std::endl;
+			return 1;
+		}
+	}
+
+	// Independent statements are pipelined, results come back as a tuple
+	{
+		auto p = db.prepare(insert_into(t).set(t.gamma = false, t.delta = parameter(t.delta)));
+		p.params.delta = 17;
+
+		const auto pipeline_count = db._pipeline_count;
+		db._result_rows = 3;
+		auto results = db.run_pipeline(
+				select(t.alpha).from(t).where(t.alpha > 7),
+				insert_into(t).set(t.gamma = true, t.delta = 3),
+				p);
+		db._result_rows = 0;
+		static_assert(std::is_same<typename std::tuple_element<1, decltype(results)>::type, size_t>::value, "type requirement");
+		static_assert(std::is_same<typename std::tuple_element<2, decltype(results)>::type, size_t>::value, "type requirement");
+		if (db._pipeline_count != pipeline_count + 1 or db._reading_replies)
+		{
+			std::cerr << "statements not pipelined" << std::endl;
+			return 1;
+		}
+
+		std::vector<int64_t> alpha;
+		for (const auto& row : std::get<0>(results))
+		{
+			alpha.push_back(row.alpha);
+		}
+		if (alpha != std::vector<int64_t>{0, 1, 2})
+		{
+			std::cerr << "rows of pipelined select not returned" << std::endl;
+			return 1;
+		}
+
+		auto sequential = sqlpp::run_pipeline_sequentially(db, remove_from(t).where(t.alpha == 3), p);
+		if (db._pipeline_count != pipeline_count + 1 or std::get<0>(sequential) != 0)
+		{
+			std::cerr << "statements not run sequentially" << std::endl;
+			return 1;
+		}
+	}
+
 	return 0;
 }
@@ -23,12 +23,133 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <type_traits>
 #include "Sample.h"
 #include "MockDb.h"
 #include <sqlpp11/sqlpp11.h>
 
 
+namespace
+{
+	struct bar_t
+	{
+		int64_t alpha;
+		std::string beta;
+		bool gamma;
+	};
+
+	// Yields a single row with a NaN value
+	struct nan_result_t
+	{
+		bool _done = false;
+
+		template<typename ResultRow>
+			void next(ResultRow& result_row)
+			{
+				if (_done)
+				{
+					result_row._invalidate();
+					return;
+				}
+				if (not result_row)
+					result_row._validate();
+				result_row._bind(*this);
+				_done = true;
+			}
+
+		void _bind_floating_point_result(size_t, double* value, bool* is_null)
+		{
+			*value = std::numeric_limits<double>::quiet_NaN();
+			*is_null = false;
+		}
+	};
+
+	// Binds the row once and writes values and NULL indicators via the kept pointers when fetching,
+	// like connectors that hand them to the client library
+	struct deferred_result_t
+	{
+		size_t _rows;
+		int64_t* _alpha = nullptr;
+		bool* _alpha_is_null = nullptr;
+		signed char* _gamma = nullptr;
+		bool* _gamma_is_null = nullptr;
+
+		template<typename ResultRow>
+			void next(ResultRow& result_row)
+			{
+				if (not _rows)
+				{
+					result_row._invalidate();
+					return;
+				}
+				if (not result_row)
+				{
+					result_row._validate();
+					result_row._bind(*this);
+				}
+				*_alpha = static_cast<int64_t>(_rows);
+				*_alpha_is_null = _rows == 2;
+				*_gamma = true;
+				*_gamma_is_null = false;
+				--_rows;
+			}
+
+		void _bind_integral_result(size_t, int64_t* value, bool* is_null)
+		{
+			_alpha = value;
+			_alpha_is_null = is_null;
+		}
+
+		void _bind_boolean_result(size_t, signed char* value, bool* is_null)
+		{
+			_gamma = value;
+			_gamma_is_null = is_null;
+		}
+	};
+
+	// Yields rows one at a time, without bulk retrieval
+	struct row_by_row_result_t
+	{
+		size_t _rows;
+
+		template<typename ResultRow>
+			void next(ResultRow& result_row)
+			{
+				if (not _rows)
+				{
+					result_row._invalidate();
+					return;
+				}
+				if (not result_row)
+					result_row._validate();
+				result_row._bind(*this);
+				--_rows;
+			}
+
+		void _bind_integral_result(size_t, int64_t* value, bool* is_null)
+		{
+			*value = static_cast<int64_t>(_rows);
+			*is_null = _rows == 2;
+		}
+
+		void _bind_boolean_result(size_t, signed char* value, bool* is_null)
+		{
+			*value = true;
+			*is_null = false;
+		}
+
+		void _bind_text_result(size_t, const char** text, size_t* len)
+		{
+			*text = "cake";
+			*len = 4;
+		}
+	};
+}
+
 static_assert(not sqlpp::enforce_null_result_treatment_t<MockDb>::value, "MockDb interprets NULL as trivial");
 static_assert(sqlpp::enforce_null_result_treatment_t<EnforceDb>::value, "MockDb does not interpret NULL as trivial");
 
@@ -85,5 +206,271 @@ int main()
 		static_assert(not sqlpp::null_is_trivial_value_t<decltype(row.alpha)>::value, "row.alpha interprets null_is_trivial");
 	}
 
+	// Blob result fields expose the bytes of the connector without copying them
+	{
+		struct target_t
+		{
+			void _bind_blob_result(size_t, const char** data, size_t* len)
+			{
+				*data = bytes;
+				*len = sizeof(bytes);
+			}
+
+			const char bytes[3] = {'\x01', '\x00', '\xfe'};
+		};
+
+		using FieldSpec = sqlpp::field_spec_t<test::TabFoo_::Book::_alias_t, sqlpp::blob, true, false>;
+		sqlpp::result_field_t<sqlpp::blob, MockDb, FieldSpec> field;
+		target_t target;
+		field._bind(target, 0);
+		if (static_cast<const void*>(field.view().data()) != target.bytes or field.view().size() != 3 
+				or field != std::vector<std::uint8_t>{0x01, 0x00, 0xfe})
+		{
+			std::cerr << "blob not exposed" << std::endl;
+			return 1;
+		}
+	}
+
+	// Rows can be fetched into columns, in bulk if the connector supports it
+	{
+		db._result_rows = 5;
+		auto result = db(select(t.alpha, t.beta, t.gamma).from(t).where(true));
+		db._result_rows = 0;
+		auto batch = sqlpp::make_column_batch(result, 2);
+		static_assert(std::is_same<decltype(batch.column<2>().values()), const signed char*>::value, "boolean columns are bound like boolean fields");
+		std::vector<int64_t> alpha;
+		while (result.fetch_columns(batch))
+		{
+			if (batch.column<1>()[0] != "cheesecake with strawberries" or batch.column<2>()[0] != (alpha.size() % 2 == 1))
+			{
+				std::cerr << "wrong columns fetched" << std::endl;
+				return 1;
+			}
+			alpha.insert(alpha.end(), batch.column<0>().values(), batch.column<0>().values() + batch.size());
+		}
+		if (alpha != std::vector<int64_t>{0, 1, 2, 3, 4} or not result.empty())
+		{
+			std::cerr << "wrong rows fetched" << std::endl;
+			return 1;
+		}
+
+		using Row = typename std::decay<decltype(result.front())>::type;
+		sqlpp::result_t<row_by_row_result_t, Row> row_by_row{row_by_row_result_t{4}, std::vector<std::string>{}};
+		auto columns = sqlpp::make_column_batch(row_by_row, 3);
+		if (row_by_row.fetch_columns(columns) != 3 or columns.column<0>()[2] != 0 or not columns.column<0>().is_null(2)
+				or row_by_row.fetch_columns(columns) != 1 or columns.column<0>()[0] != 1 or row_by_row.fetch_columns(columns) != 0)
+		{
+			std::cerr << "wrong rows fetched row by row" << std::endl;
+			return 1;
+		}
+
+		// NULL indicators are packed, bulk binds start at the first free row
+		std::uint8_t bits[2] = {};
+		sqlpp::null_bitmap_ref_t free_rows(bits, 6);
+		free_rows.set(0, true);
+		free_rows.set(3, true);
+		free_rows.set(3, false);
+		free_rows.set(4, true);
+		if (bits[0] != 0x40 or bits[1] != 0x04 or not sqlpp::null_bitmap_ref_t(bits).test(10) or free_rows.test(3))
+		{
+			std::cerr << "wrong null bitmap" << std::endl;
+			return 1;
+		}
+		free_rows.fill(1, 9, true);
+		free_rows.fill(2, 2, false);
+		if (bits[0] != 0xc0 or bits[1] != 0xfc)
+		{
+			std::cerr << "wrong null bitmap range" << std::endl;
+			return 1;
+		}
+	}
+
+	// Rows can be moved into structs directly
+	{
+		db._result_rows = 3;
+		auto result = db(select(t.alpha, t.beta, t.gamma).from(t).where(true));
+		db._result_rows = 0;
+		const auto first = result.into<bar_t>();
+		const auto rest = result.as_vector<bar_t>();
+		if (first.alpha != 0 or first.beta != "cheesecake with strawberries" or first.gamma 
+				or rest.size() != 2 or rest[1].alpha != 2 or not rest[0].gamma or not result.empty())
+		{
+			std::cerr << "rows not moved into structs" << std::endl;
+			return 1;
+		}
+		try
+		{
+			result.into<bar_t>();
+			std::cerr << "into() on an empty result did not throw" << std::endl;
+			return 1;
+		}
+		catch (const sqlpp::exception&)
+		{
+		}
+	}
+
+	// Text result fields expose the characters of the connector without copying them
+	{
+		db._result_rows = 1;
+		auto result = db(select(t.beta).from(t).where(true));
+		db._result_rows = 0;
+		const auto& row = result.front();
+		std::ostringstream os;
+		os << row.beta;
+		if (row.beta.view() != "cheesecake with strawberries" or row.beta != "cheesecake with strawberries"
+				or os.str() != row.beta.value())
+		{
+			std::cerr << "text not exposed" << std::endl;
+			return 1;
+		}
+	}
+
+	// Numeric result fields are written like their values, with the format of the stream
+	{
+		test::TabFoo f;
+		db._result_rows = 2;
+		auto result = db(select(f.omega).from(f).where(true));
+		db._result_rows = 0;
+		result.pop_front();
+		std::ostringstream os;
+		os << std::fixed << std::setprecision(3) << result.front().omega;
+
+		using Row = typename std::decay<decltype(result.front())>::type;
+		sqlpp::result_t<nan_result_t, Row> nan_result{nan_result_t{}, std::vector<std::string>{}};
+		std::ostringstream nan_os;
+		nan_os << nan_result.front().omega;
+		if (os.str() != "0.500" or nan_os.str() != "nan")
+		{
+			std::cerr << "numeric field not written like its value: " << os.str() << ", " << nan_os.str() << std::endl;
+			return 1;
+		}
+	}
+
+	// Dynamic fields are found by name or by a handle resolved once
+	{
+		auto s = dynamic_select(db).dynamic_columns(t.alpha).from(t).where(true);
+		s.selected_columns.add(t.beta);
+		s.selected_columns.add(t.delta);
+		db._result_rows = 2;
+		auto result = db(s);
+		db._result_rows = 0;
+		const auto delta = result.front().handle("delta");
+		size_t rows = 0;
+		for (const auto& row : result)
+		{
+			if (&row.at(delta) != &row.at("delta") or row.at("beta") != "cheesecake with strawberries")
+			{
+				std::cerr << "dynamic field not found" << std::endl;
+				return 1;
+			}
+			++rows;
+		}
+		if (rows != 2)
+		{
+			std::cerr << "dynamic rows missing" << std::endl;
+			return 1;
+		}
+	}
+
+	// Fields of columns that cannot be NULL carry no NULL indicator
+	{
+		using NotNull = sqlpp::field_spec_t<test::TabBar_::Gamma::_alias_t, sqlpp::integral, false, false>;
+		using Nullable = sqlpp::field_spec_t<test::TabBar_::Gamma::_alias_t, sqlpp::integral, true, false>;
+		static_assert(sizeof(sqlpp::result_field_t<sqlpp::integral, MockDb, NotNull>) == sizeof(int64_t), "unexpected NULL indicator");
+		static_assert(sizeof(sqlpp::result_field_t<sqlpp::integral, MockDb, Nullable>) > sizeof(int64_t), "missing NULL indicator");
+		static_assert(sqlpp::can_be_null_t<decltype(max(t.gamma))>::value, "max() is NULL for an empty set of rows");
+
+		db._result_rows = 2;
+		auto result = db(select(t.alpha, t.gamma).from(t).where(true));
+		db._result_rows = 0;
+		result.pop_front();
+		const auto& row = result.front();
+		if (row.alpha.is_null() or row.alpha != 1 or row.gamma.is_null() or not row.gamma)
+		{
+			std::cerr << "wrong NULL indicator" << std::endl;
+			return 1;
+		}
+
+		// Connectors without a bulk bitmap bind report NULL per field, moved rows keep their bitmap
+		using Row = typename std::decay<decltype(result.front())>::type;
+		sqlpp::result_t<row_by_row_result_t, Row> row_by_row{row_by_row_result_t{3}, std::vector<std::string>{}};
+		if (row_by_row.front().alpha.is_null() or row_by_row.front().alpha != 3)
+		{
+			std::cerr << "wrong NULL indicator row by row" << std::endl;
+			return 1;
+		}
+		row_by_row.pop_front();
+		auto moved = std::move(row_by_row);
+		const auto was_null = moved.front().alpha.is_null();
+		moved.pop_front();
+		if (not was_null or moved.front().alpha.is_null() or moved.front().alpha != 1)
+		{
+			std::cerr << "NULL indicator lost by moving" << std::endl;
+			return 1;
+		}
+
+		// Connectors may keep the indicators and write them after binding
+		sqlpp::result_t<deferred_result_t, Row> deferred{deferred_result_t{3}, std::vector<std::string>{}};
+		std::vector<bool> alpha_is_null;
+		for (const auto& row : deferred)
+		{
+			if (row.gamma.is_null() or not row.gamma)
+			{
+				std::cerr << "wrong deferred boolean" << std::endl;
+				return 1;
+			}
+			alpha_is_null.push_back(row.alpha.is_null());
+		}
+		if (alpha_is_null != std::vector<bool>{false, true, false})
+		{
+			std::cerr << "wrong deferred NULL indicators" << std::endl;
+			return 1;
+		}
+	}
+
+	// Batches are fetched ahead on a helper thread and handed out in order
+	{
+		db._result_rows = 10;
+		db._fetch_latency = std::chrono::microseconds{100};
+		auto prefetched = sqlpp::prefetch(db(select(t.alpha, t.beta).from(t).where(true)), 2, 3);
+		auto abandoned = sqlpp::prefetch(db(select(t.alpha, t.beta).from(t).where(true)), 1, 3);
+		db._fetch_latency = std::chrono::microseconds{0};
+		db._result_rows = 0;
+		if (abandoned.next_batch() == nullptr)
+		{
+			std::cerr << "prefetched batch missing" << std::endl;
+			return 1;
+		}
+		int64_t expected = 0;
+		size_t batches = 0;
+		while (const auto batch = prefetched.next_batch())
+		{
+			for (size_t i = 0; i < batch->size(); ++i)
+			{
+				if (batch->column<0>()[i] != expected++ or batch->column<1>()[i] != "cheesecake with strawberries")
+				{
+					std::cerr << "wrong prefetched row" << std::endl;
+					return 1;
+				}
+			}
+			++batches;
+		}
+		if (expected != 10 or batches != 4 or prefetched.next_batch() != nullptr)
+		{
+			std::cerr << "prefetched rows missing" << std::endl;
+			return 1;
+		}
+
+		try
+		{
+			sqlpp::prefetch(db(select(t.alpha).from(t).where(true)), 2, 0);
+			std::cerr << "empty batches accepted" << std::endl;
+			return 1;
+		}
+		catch (const sqlpp::exception&)
+		{
+		}
+	}
+
 	return 0;
 }
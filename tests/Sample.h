@@ -57,12 +57,29 @@ namespace test
       };
       using _traits = sqlpp::make_traits<sqlpp::floating_point, sqlpp::tag::can_be_null>;
     };
+    struct Book
+    {
+      struct _alias_t
+      {
+        static constexpr const char _literal[] =  "book";
+        using _name_t = sqlpp::make_char_sequence<sizeof(_literal), _literal>;
+        template<typename T>
+        struct _member_t
+          {
+            T book;
+            T& operator()() { return book; }
+            const T& operator()() const { return book; }
+          };
+      };
+      using _traits = sqlpp::make_traits<sqlpp::blob, sqlpp::tag::can_be_null>;
+    };
   }
 
   struct TabFoo: sqlpp::table_t<TabFoo,
                TabFoo_::Delta,
                TabFoo_::Epsilon,
-               TabFoo_::Omega>
+               TabFoo_::Omega,
+               TabFoo_::Book>
   {
     struct _alias_t
     {
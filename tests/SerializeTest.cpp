@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2013-2015, Roland Bock
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ * 
+ *  * Redistributions of source code must retain the above copyright notice, 
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice, 
+ *    this list of conditions and the following disclaimer in the documentation 
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE 
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED 
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Sample.h"
+#include "MockDb.h"
+#include <sqlpp11/sqlpp11.h>
+
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+
+namespace
+{
+	int failures = 0;
+
+	template<typename Expression>
+		void compare(int line, const Expression& expression, const std::string& expected)
+		{
+			MockDb::_serializer_context_t printer;
+			const auto result = serialize(expression, printer).str();
+			if (result != expected)
+			{
+				std::cerr << __FILE__ << " " << line << ": expected \"" << expected << "\", got \"" << result << "\"" << std::endl;
+				++failures;
+			}
+		}
+
+	template<typename Expression>
+		void check_size(int line, const Expression& expression)
+		{
+			MockDb::_serializer_context_t printer;
+			const auto size = serialized_size(expression, printer);
+			serialize(expression, printer);
+			if (size != printer.size())
+			{
+				std::cerr << __FILE__ << " " << line << ": expected size " << printer.size() << ", got " << size << std::endl;
+				++failures;
+			}
+		}
+
+	template<typename Expression>
+		void check_chunks(int line, const Expression& expression)
+		{
+			MockDb::_serializer_context_t printer;
+			serialize(expression, printer);
+			sqlpp::chunked_context_t context;
+			serialize(expression, context);
+			if (context.str() != printer.str() or context.size() != printer.size())
+			{
+				std::cerr << __FILE__ << " " << line << ": expected \"" << printer.str() << "\", got \"" << context.str() << "\"" << std::endl;
+				++failures;
+			}
+		}
+
+	// A context that only knows the classic escape(std::string)
+	struct escape_only_context_t
+	{
+		std::string _text;
+
+		template<typename T>
+			escape_only_context_t& operator<<(const T& t)
+			{
+				_text += t;
+				return *this;
+			}
+
+		static std::string escape(std::string arg)
+		{
+			return sqlpp::serializer_context_t::escape(arg);
+		}
+	};
+
+	// A connector context that inherits the buffer, but escapes with backslashes
+	struct backslash_context_t: public sqlpp::serializer_context_t
+	{
+		static std::string escape(const std::string& arg)
+		{
+			std::string result;
+			for (const auto c : arg)
+			{
+				if (c == '\'' or c == '\\')
+					result.push_back('\\');
+				result.push_back(c);
+			}
+			return result;
+		}
+	};
+}
+
+int main()
+{
+	test::TabBar t;
+
+	// text literals
+	compare(__LINE__, t.beta == "", "(tab_bar.beta='')");
+	compare(__LINE__, t.beta == "cheesecake", "(tab_bar.beta='cheesecake')");
+	compare(__LINE__, t.beta == "'", "(tab_bar.beta='''')");
+	compare(__LINE__, t.beta == "Roland's 'cheese'cake''", "(tab_bar.beta='Roland''s ''cheese''cake''''')");
+	compare(__LINE__, t.beta == std::string("nul\0byte", 8), std::string("(tab_bar.beta='nul\0byte')", 25));
+
+	// escape() is still available for contexts and connectors
+	if (sqlpp::serializer_context_t::escape("it's") != "it''s")
+	{
+		std::cerr << __FILE__ << " " << __LINE__ << ": escape() failed" << std::endl;
+		++failures;
+	}
+
+	// contexts without append_escaped fall back to escape()
+	{
+		escape_only_context_t context;
+		serialize(t.beta == "it's", context);
+		if (context._text != "(tab_bar.beta='it''s')")
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": got " << context._text << std::endl;
+			++failures;
+		}
+	}
+
+	// contexts that override escape() keep their escaping, also for the size estimate
+	{
+		static_assert(sqlpp::detail::escapes_in_place<sqlpp::serializer_context_t>::value, "append_escaped() expected");
+		static_assert(not sqlpp::detail::escapes_in_place<backslash_context_t>::value, "escape() expected");
+		backslash_context_t context;
+		serialize(t.beta == "it's", context);
+		if (context.str() != "(tab_bar.beta='it\\'s')" or sqlpp::serialized_size(t.beta == "it's", context) != context.str().size())
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": got " << context.str() << std::endl;
+			++failures;
+		}
+	}
+
+	// statements without runtime data are rendered once per type, in contexts that opt in for themselves
+	{
+		static_assert(sqlpp::cache_static_sql_t<sqlpp::serializer_context_t>::value, "opt-in expected");
+		static_assert(sqlpp::cache_static_sql_t<MockDb::_serializer_context_t>::value, "opt-in expected");
+		static_assert(not sqlpp::cache_static_sql_t<backslash_context_t>::value, "inherited opt-in");
+		test::TabFoo f;
+		auto s = select(t.alpha).from(t);
+		static_assert(not sqlpp::has_runtime_data_t<decltype(s)>::value, "no runtime data expected");
+		static_assert(sqlpp::has_runtime_data_t<decltype(select(t.alpha).from(t).where(t.alpha == 7))>::value, "runtime data expected");
+		static_assert(not sqlpp::has_runtime_data_t<decltype(select(t.alpha).from(t).where(t.alpha == parameter(t.alpha)))>::value, "no runtime data expected");
+		static_assert(sqlpp::has_runtime_data_t<decltype(dynamic_select(MockDb{}, t.alpha).from(t).dynamic_where())>::value, "runtime data expected");
+		static_assert(sqlpp::has_runtime_data_t<decltype(select(t.alpha).from(t.join(f).on(t.alpha == 7)))>::value, "runtime data expected");
+
+		compare(__LINE__, s, "SELECT tab_bar.alpha FROM tab_bar");
+		compare(__LINE__, s, "SELECT tab_bar.alpha FROM tab_bar");
+
+		MockDb::_serializer_context_t printer;
+		printer << "-- ";
+		serialize(s, printer);
+		if (printer.str() != "-- SELECT tab_bar.alpha FROM tab_bar")
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": got " << printer.str() << std::endl;
+			++failures;
+		}
+
+		// static sub-selects are cached even if the outer statement is not
+		compare(__LINE__, select(t.alpha).from(t).where(t.alpha.in(select(f.omega).from(f)) and t.beta == "x"),
+				"SELECT tab_bar.alpha FROM tab_bar WHERE (tab_bar.alpha IN(SELECT tab_foo.omega FROM tab_foo) AND (tab_bar.beta='x'))");
+		compare(__LINE__, select(t.alpha).from(t).where(t.beta == "y"), "SELECT tab_bar.alpha FROM tab_bar WHERE (tab_bar.beta='y')");
+	}
+
+	// static parts of dynamic statements are cached, the dynamic parts are spliced in
+	{
+		auto s = dynamic_select(MockDb{}, t.alpha, t.beta).from(t).dynamic_where();
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar");
+		s.where.add(t.alpha > 7);
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE (tab_bar.alpha>7)");
+		s.where.add(t.beta == "z");
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE (tab_bar.alpha>7) AND (tab_bar.beta='z')");
+	}
+
+	// the static columns of a dynamic column list are cached on their own
+	{
+		auto s = dynamic_select(MockDb{}).dynamic_columns(t.alpha, t.beta).from(t).where(true);
+		static_assert(sqlpp::serializer_t<MockDb::_serializer_context_t, decltype(s.selected_columns._data)>::_is_cached::value, "static columns are cached");
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar");
+		s.selected_columns.add(t.delta);
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta,tab_bar.delta FROM tab_bar");
+	}
+
+	// numbers do not depend on the locale, doubles survive a round trip
+	{
+		test::TabFoo f;
+		const char* locale = nullptr;
+		for (const auto name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"})
+		{
+			if (std::setlocale(LC_ALL, name) and std::localeconv()->decimal_point[0] == ',')
+			{
+				locale = name;
+				break;
+			}
+		}
+		if (not locale)
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": no locale with a decimal comma installed, testing with the C locale" << std::endl;
+		}
+		compare(__LINE__, t.alpha == 0, "(tab_bar.alpha=0)");
+		compare(__LINE__, t.alpha == -17, "(tab_bar.alpha=-17)");
+		compare(__LINE__, t.alpha == std::numeric_limits<int64_t>::max(), "(tab_bar.alpha=9223372036854775807)");
+		compare(__LINE__, t.alpha == std::numeric_limits<int64_t>::min(), "(tab_bar.alpha=-9223372036854775808)");
+		compare(__LINE__, f.omega == 0.5, "(tab_foo.omega=0.5)");
+		compare(__LINE__, f.omega == -1.25, "(tab_foo.omega=-1.25)");
+		compare(__LINE__, f.omega == 1234567.0, "(tab_foo.omega=1234567)");
+		compare(__LINE__, f.omega == 0.1, "(tab_foo.omega=0.1)");
+
+		MockDb::_serializer_context_t printer;
+		serialize(sqlpp::wrap_operand_t<double>{1.0 / 3.0}, printer);
+		std::setlocale(LC_ALL, "C");
+		if (std::strtod(printer.str().c_str(), nullptr) != 1.0 / 3.0)
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": no round trip for " << printer.str() << std::endl;
+			++failures;
+		}
+	}
+
+	// NaN and infinity have no SQL literal
+	{
+		test::TabFoo f;
+		for (const auto value : {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()})
+		{
+			try
+			{
+				MockDb::_serializer_context_t printer;
+				serialize(f.omega == value, printer);
+				std::cerr << __FILE__ << " " << __LINE__ << ": serialized " << printer.str() << std::endl;
+				++failures;
+			}
+			catch (const sqlpp::exception&)
+			{
+			}
+		}
+	}
+
+	// serialized_size() predicts the exact number of characters
+	{
+		test::TabFoo f;
+		auto i = insert_into(t).columns(t.beta, t.gamma, t.delta);
+		i.values.add(t.beta = "it's", t.gamma = true, t.delta = -42);
+		i.values.add(t.beta = "cake", t.gamma = false, t.delta = sqlpp::null);
+		check_size(__LINE__, i);
+
+		auto s = dynamic_select(MockDb{}).dynamic_columns(t.alpha, f.omega).from(t, f).dynamic_where(t.beta == "''");
+		s.selected_columns.add(f.epsilon);
+		s.where.add(f.omega > 0.1);
+		check_size(__LINE__, s);
+		check_size(__LINE__, select(t.alpha).from(t).where(t.alpha.in(sqlpp::value_list(std::vector<int>{1, 22, -333}))));
+	}
+
+	// chunked contexts produce the same text, static parts are referenced in place
+	{
+		test::TabFoo f;
+		check_chunks(__LINE__, select(all_of(t)).from(t).where(t.beta == "it's" and t.alpha.in(1, 2, 3)).limit(17));
+		auto s = dynamic_select(MockDb{}).dynamic_columns(t.alpha).from(t).dynamic_where(f.omega > 1.5);
+		s.selected_columns.add(t.beta);
+		check_chunks(__LINE__, s);
+		auto i = insert_into(t).columns(t.beta, t.gamma);
+		for (int row = 0; row < 10000; ++row)
+		{
+			i.values.add(t.beta = std::to_string(row), t.gamma = true);
+		}
+		check_chunks(__LINE__, i);
+
+		const auto statement = select(all_of(t), f.omega, f.epsilon).from(t.join(f).on(t.alpha == f.omega));
+		sqlpp::chunked_context_t first;
+		serialize(statement, first);
+		sqlpp::chunked_context_t second;
+		serialize(statement, second);
+		if (first.chunks().size() != 1 or second.chunks().size() != 1 or first.chunks().front().data != second.chunks().front().data)
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": static statement not referenced in place" << std::endl;
+			++failures;
+		}
+
+		// other text, e.g. in char arrays on the stack, is copied
+		{
+			char buffer[100];
+			std::fill(buffer, buffer + 99, 'x');
+			buffer[99] = '\0';
+			sqlpp::chunked_context_t context;
+			context << buffer;
+			if (context.chunks().size() != 1 or context.chunks().front().data == buffer)
+			{
+				std::cerr << __FILE__ << " " << __LINE__ << ": char array referenced" << std::endl;
+				++failures;
+			}
+		}
+
+		MockDb db;
+		const char* temp_dir = std::getenv("TMPDIR") ? std::getenv("TMPDIR") : std::getenv("TEMP");
+		db._chunk_file = std::string(temp_dir ? temp_dir : "/tmp") + "/SerializeTestChunks.sql";
+		const auto written = db.execute_chunked(i);
+		std::ifstream file(db._chunk_file, std::ios::binary);
+		const auto content = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		MockDb::_serializer_context_t printer;
+		serialize(i, printer);
+		if (written != content.size() or content != printer.str())
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": chunks not written to file" << std::endl;
+			++failures;
+		}
+		file.close();
+		std::remove(db._chunk_file.c_str());
+	}
+
+	// dynamic parts are stored in place or on the heap, copies are independent
+	{
+		auto s = dynamic_select(MockDb{}, t.alpha).from(t).dynamic_where();
+		s.where.add(t.alpha > 7);
+		s.where.add(t.beta == "cheese" and t.beta != "cake" and t.beta.like("%eese") and t.beta > "apple pie");
+		auto copy = s;
+		copy.where.add(t.gamma == true);
+		compare(__LINE__, s, "SELECT tab_bar.alpha FROM tab_bar WHERE (tab_bar.alpha>7) AND ((((tab_bar.beta='cheese') AND (tab_bar.beta!='cake')) AND tab_bar.beta LIKE('%eese')) AND (tab_bar.beta>'apple pie'))");
+		compare(__LINE__, copy, "SELECT tab_bar.alpha FROM tab_bar WHERE (tab_bar.alpha>7) AND ((((tab_bar.beta='cheese') AND (tab_bar.beta!='cake')) AND tab_bar.beta LIKE('%eese')) AND (tab_bar.beta>'apple pie')) AND (tab_bar.gamma=1)");
+	}
+
+	// moved-from values do not point to the heap object they handed over
+	{
+		struct base_t { virtual ~base_t() = default; };
+		struct big_t: public base_t { char data[256]; };
+		using value_t = sqlpp::detail::polymorphic_value_t<base_t, 32>;
+		value_t value{sqlpp::detail::in_place_type_t<big_t>{}};
+		auto moved = std::move(value);
+		value_t assigned{sqlpp::detail::in_place_type_t<big_t>{}};
+		assigned = std::move(moved);
+		if (moved._is_inline() or value.operator->() or moved.operator->() or not assigned.operator->())
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": moved-from value still points to the object" << std::endl;
+			++failures;
+		}
+	}
+
+	// dynamic parts of statements built from a statement with an arena allocate from that arena
+	{
+		const auto arena = sqlpp::make_arena(256);
+		auto s = dynamic_select(MockDb{}).use_arena(arena).dynamic_columns().from(t).dynamic_where();
+		s.selected_columns.add(t.alpha);
+		s.selected_columns.add(t.beta);
+		s.where.add(t.alpha > 7);
+		s.where.add(t.beta == "cheese");
+		compare(__LINE__, s, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE (tab_bar.alpha>7) AND (tab_bar.beta='cheese')");
+		if (s._arena.get() != arena or arena->block_count() == 0)
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": dynamic parts not allocated from the arena" << std::endl;
+			++failures;
+		}
+
+		// copies, e.g. for sqlpp::async(), allocate from the free store
+		auto copy = s;
+		copy.where.add(t.gamma == true);
+		if (copy._arena or copy.where._data._dynamic_expressions._serializables.get_allocator()._arena or s.where._data._dynamic_expressions._serializables.size() != 2)
+		{
+			std::cerr << __FILE__ << " " << __LINE__ << ": copy shares the arena" << std::endl;
+			++failures;
+		}
+		compare(__LINE__, copy, "SELECT tab_bar.alpha,tab_bar.beta FROM tab_bar WHERE (tab_bar.alpha>7) AND (tab_bar.beta='cheese') AND (tab_bar.gamma=1)");
+	}
+
+	// fingerprints ignore literal values, but not the shape of dynamic parts
+	{
+		const auto check_fingerprint = [](int line, bool same, std::uint64_t lhs, std::uint64_t rhs)
+		{
+			if ((lhs == rhs) != same)
+			{
+				std::cerr << __FILE__ << " " << line << ": unexpected fingerprint" << std::endl;
+				++failures;
+			}
+		};
+		check_fingerprint(__LINE__, true, fingerprint(select(t.alpha).from(t).where(t.alpha > 7)), fingerprint(select(t.alpha).from(t).where(t.alpha > 8)));
+		check_fingerprint(__LINE__, true, fingerprint(select(t.alpha).from(t).where(t.beta == "a")), fingerprint(select(t.alpha).from(t).where(t.beta == "b")));
+		check_fingerprint(__LINE__, false, fingerprint(select(t.alpha).from(t).where(t.alpha > 7)), fingerprint(select(t.alpha).from(t).where(t.alpha < 7)));
+		check_fingerprint(__LINE__, false, fingerprint(select(t.alpha).from(t).where(t.alpha > 7)), fingerprint(select(t.beta).from(t).where(t.alpha > 7)));
+		check_fingerprint(__LINE__, false, fingerprint(select(t.alpha).from(t).where(sqlpp::verbatim<sqlpp::boolean>("a"))), fingerprint(select(t.alpha).from(t).where(sqlpp::verbatim<sqlpp::boolean>("b"))));
+
+		const auto make_dynamic = [&t](){ return dynamic_select(MockDb{}, t.alpha).from(t).dynamic_where(); };
+		auto s1 = make_dynamic();
+		auto s2 = make_dynamic();
+		auto s3 = make_dynamic();
+		auto s4 = make_dynamic();
+		s1.where.add(t.alpha > 7);
+		s2.where.add(t.alpha > 8);
+		s3.where.add(t.gamma == true);
+		s4.where.add(t.alpha > 7);
+		s4.where.add(t.alpha > 7);
+		check_fingerprint(__LINE__, true, fingerprint(s1), fingerprint(s2));
+		check_fingerprint(__LINE__, false, fingerprint(s1), fingerprint(s3));
+		check_fingerprint(__LINE__, false, fingerprint(s1), fingerprint(s4));
+		check_fingerprint(__LINE__, false, fingerprint(s1), fingerprint(make_dynamic()));
+	}
+
+	// blobs are serialized as hex literals
+	{
+		test::TabFoo f;
+		compare(__LINE__, f.book == std::vector<std::uint8_t>{0x00, 0x7f, 0xab}, "(tab_foo.book=X'007FAB')");
+		compare(__LINE__, insert_into(f).set(f.book = std::vector<std::uint8_t>{0xca, 0xfe}), "INSERT  INTO tab_foo (book) VALUES(X'CAFE')");
+		compare(__LINE__, f.book == std::vector<std::uint8_t>(300, 0x11), "(tab_foo.book=X'" + std::string(600, '1') + "')");
+	}
+
+	return failures;
+}